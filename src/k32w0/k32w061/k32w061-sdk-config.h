@@ -64,6 +64,8 @@
 #endif
 
 #define UART_USE_DRIVER 0
+#define UART_USE_DRIVER_RX_DMA 0
+#define UART_USE_DRIVER_TX_DMA 0
 #define UART_USE_SERIAL_MGR 1
 #define UART_USE_DRIVER_LOG 0
 #define UART_USE_SERIAL_MGR_LOG 1
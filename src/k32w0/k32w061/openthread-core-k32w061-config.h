@@ -277,6 +277,17 @@
 #define OPENTHREAD_CONFIG_MAC_SOFTWARE_ACK_TIMEOUT_ENABLE 1
 #endif
 
+/**
+ * @def K32W0_RADIO_HW_RETRANSMIT_ENABLE
+ *
+ * Define to 1 to let the MMAC retransmit the frames which are not acknowledged
+ * (OT_RADIO_CAPS_TRANSMIT_RETRIES) instead of the OpenThread MAC.
+ *
+ */
+#ifndef K32W0_RADIO_HW_RETRANSMIT_ENABLE
+#define K32W0_RADIO_HW_RETRANSMIT_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_SOFTWARE_RETRANSMIT_ENABLE
  *
@@ -284,7 +295,7 @@
  *
  */
 #ifndef OPENTHREAD_CONFIG_MAC_SOFTWARE_RETRANSMIT_ENABLE
-#define OPENTHREAD_CONFIG_MAC_SOFTWARE_RETRANSMIT_ENABLE 1
+#define OPENTHREAD_CONFIG_MAC_SOFTWARE_RETRANSMIT_ENABLE !K32W0_RADIO_HW_RETRANSMIT_ENABLE
 #endif
 
 /**
@@ -33,10 +33,13 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <openthread/config.h>
 #include <openthread/platform/alarm-milli.h>
 #include <openthread/platform/radio.h>
 
+#include "platform-k32w.h"
+
 #if OPENTHREAD_ENABLE_DIAG
 
 /**
@@ -45,10 +48,128 @@
  */
 static bool sDiagMode = false;
 
+#if K32W0_RADIO_STATS_ENABLE
+static size_t K32WDiagPrintHist(char *aOutput, size_t aOutputMaxLen, const char *aName, const uint32_t *aHist,
+                                uint32_t aMaxCycles)
+{
+    size_t len = snprintf(aOutput, aOutputMaxLen, "%s max:%lu hist:", aName, (unsigned long)aMaxCycles);
+
+    for (uint8_t i = 0; (i < K32W_RADIO_STATS_NUM_OF_BINS) && (len < aOutputMaxLen); i++)
+    {
+        len += snprintf(aOutput + len, aOutputMaxLen - len, " %lu", (unsigned long)aHist[i]);
+    }
+
+    if (len < aOutputMaxLen)
+    {
+        len += snprintf(aOutput + len, aOutputMaxLen - len, "\r\n");
+    }
+
+    return len;
+}
+
+/**
+ * Radio driver telemetry: `diag radiostats [state|tx|rx|wake|isr|reset]`
+ *
+ */
+static void K32WDiagRadioStats(int argc, char *argv[], char *aOutput, size_t aOutputMaxLen)
+{
+    K32WRadioStats         stats;
+    K32WRadioFpStats       fpStats;
+    K32WRadioWakeStats     wakeStats;
+    K32WRadioRxFilterStats filterStats;
+    const char *           group = (argc > 1) ? argv[1] : NULL;
+    size_t                 len   = 0;
+
+    if ((group != NULL) && (strcmp(group, "reset") == 0))
+    {
+        K32WRadioResetStats();
+        K32WRadioResetFpStats();
+        K32WRadioResetWakeStats();
+        K32WRadioResetRxFilterStats();
+        snprintf(aOutput, aOutputMaxLen, "radio stats reset\r\n");
+        return;
+    }
+
+    K32WRadioGetStats(&stats);
+    K32WRadioGetFpStats(&fpStats);
+    K32WRadioGetWakeStats(&wakeStats);
+    K32WRadioGetRxFilterStats(&filterStats);
+
+    if ((group == NULL) || (strcmp(group, "state") == 0))
+    {
+        /* residency in ms */
+        len += snprintf(aOutput + len, aOutputMaxLen - len,
+                        "state(ms) disabled:%lu sleep:%lu rx:%lu tx:%lu rxoff:%lu edscan:%lu\r\n",
+                        (unsigned long)(stats.stateTime[K32W_RADIO_STATS_STATE_DISABLED] / 1000),
+                        (unsigned long)(stats.stateTime[K32W_RADIO_STATS_STATE_SLEEP] / 1000),
+                        (unsigned long)(stats.stateTime[K32W_RADIO_STATS_STATE_RECEIVE] / 1000),
+                        (unsigned long)(stats.stateTime[K32W_RADIO_STATS_STATE_TRANSMIT] / 1000),
+                        (unsigned long)(stats.stateTime[K32W_RADIO_STATS_STATE_RX_DISABLED] / 1000),
+                        (unsigned long)(stats.stateTime[K32W_RADIO_STATS_STATE_ED_SCAN] / 1000));
+    }
+
+    if (((group == NULL) || (strcmp(group, "tx") == 0)) && (len < aOutputMaxLen))
+    {
+        len += snprintf(aOutput + len, aOutputMaxLen - len,
+                        "tx attempts:%lu ok:%lu ccabusy:%lu noack:%lu aborted:%lu txpcto:%lu txto:%lu\r\n",
+                        (unsigned long)stats.txAttempts, (unsigned long)stats.txSuccess,
+                        (unsigned long)stats.txErrors[K32W_RADIO_STATS_TX_CCA_BUSY],
+                        (unsigned long)stats.txErrors[K32W_RADIO_STATS_TX_NO_ACK],
+                        (unsigned long)stats.txErrors[K32W_RADIO_STATS_TX_ABORTED],
+                        (unsigned long)stats.txErrors[K32W_RADIO_STATS_TX_TXPCTO],
+                        (unsigned long)stats.txErrors[K32W_RADIO_STATS_TX_TXTO]);
+    }
+
+    if (((group == NULL) || (strcmp(group, "rx") == 0)) && (len < aOutputMaxLen))
+    {
+        len += snprintf(aOutput + len, aOutputMaxLen - len,
+                        "rx accepted:%lu rejected:%lu filtered:%lu fp lookups:%lu hits:%lu\r\n",
+                        (unsigned long)stats.rxAccepted, (unsigned long)stats.rxRejected,
+                        (unsigned long)(filterStats.beacons + filterStats.beaconRequests + filterStats.broadcasts),
+                        (unsigned long)fpStats.lookups, (unsigned long)fpStats.hits);
+    }
+
+    if (((group == NULL) || (strcmp(group, "wake") == 0)) && (len < aOutputMaxLen))
+    {
+        len += snprintf(aOutput + len, aOutputMaxLen - len,
+                        "wake count:%lu last(us):%lu max(us):%lu avg(us):%lu skipped writes:%lu\r\n",
+                        (unsigned long)wakeStats.wakeups, (unsigned long)wakeStats.lastWakeToRxUs,
+                        (unsigned long)wakeStats.maxWakeToRxUs,
+                        (unsigned long)(wakeStats.wakeups ? wakeStats.totalWakeToRxUs / wakeStats.wakeups : 0),
+                        (unsigned long)wakeStats.writesSkipped);
+    }
+
+    if (((group == NULL) || (strcmp(group, "isr") == 0)) && (len < aOutputMaxLen))
+    {
+        len += K32WDiagPrintHist(aOutput + len, aOutputMaxLen - len, "isr", stats.isrHist, stats.isrMaxCycles);
+
+        if (len < aOutputMaxLen)
+        {
+            len += K32WDiagPrintHist(aOutput + len, aOutputMaxLen - len, "machdr", stats.macHdrHist,
+                                     stats.macHdrMaxCycles);
+        }
+    }
+
+    if (len == 0)
+    {
+        snprintf(aOutput, aOutputMaxLen, "usage: radiostats [state|tx|rx|wake|isr|reset]\r\n");
+    }
+}
+#endif
+
 void otPlatDiagProcess(otInstance *aInstance, int argc, char *argv[], char *aOutput, size_t aOutputMaxLen)
 {
     OT_UNUSED_VARIABLE(aInstance);
+
+#if K32W0_RADIO_STATS_ENABLE
+    if (strcmp(argv[0], "radiostats") == 0)
+    {
+        K32WDiagRadioStats(argc, argv, aOutput, aOutputMaxLen);
+        return;
+    }
+#else
     OT_UNUSED_VARIABLE(argc);
+#endif
 
     // Add more platform specific diagnostics features here.
     snprintf(aOutput, aOutputMaxLen, "diag feature '%s' is not supported\r\n", argv[0]);
@@ -41,6 +41,8 @@
 #include <stdint.h>
 
 #include <openthread/instance.h>
+#include <openthread/thread.h>
+#include <openthread/platform/radio.h>
 
 #ifndef CLOCK_32k_source
 /* If not using the external 32kHz crystal, use the internal FRO32k */
@@ -79,6 +81,366 @@ void K32WRadioInit(void);
  */
 void K32WRadioProcess(otInstance *aInstance);
 
+/**
+ * This structure represents the frame pending lookups done by the radio driver in interrupt context.
+ *
+ */
+typedef struct
+{
+    uint32_t lookups;     ///< Number of frame pending lookups.
+    uint32_t hits;        ///< Number of lookups which resulted in the frame pending bit being set.
+    uint32_t maxCycles;   ///< Longest lookup duration, in CPU cycles.
+    uint32_t totalCycles; ///< Cumulated lookup duration, in CPU cycles.
+    uint32_t cacheHits;   ///< Number of lookups answered from the decisions kept for repeated polls.
+} K32WRadioFpStats;
+
+/**
+ * This function gets the frame pending lookup statistics of the radio driver, all zero without
+ * K32W0_RADIO_STATS_ENABLE.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WRadioGetFpStats(K32WRadioFpStats *aStats);
+
+/**
+ * This function resets the frame pending lookup statistics of the radio driver.
+ *
+ */
+void K32WRadioResetFpStats(void);
+
+/**
+ * This structure represents the low power exits of the radio driver. The radio registers are not
+ * retained in low power, so the whole modem configuration is written on each exit; the shadow only
+ * skips the redundant writes done while the radio stays enabled.
+ *
+ */
+typedef struct
+{
+    uint32_t wakeups;         ///< Number of low power exits.
+    uint32_t lastWakeToRxUs;  ///< Latency from the last low power exit to RX enabled, in us.
+    uint32_t maxWakeToRxUs;   ///< Longest latency from a low power exit to RX enabled, in us.
+    uint32_t totalWakeToRxUs; ///< Cumulated latency from the low power exits to RX enabled, in us.
+    uint32_t writesSkipped;   ///< Number of redundant modem writes skipped from a low power exit to RX enabled.
+} K32WRadioWakeStats;
+
+/**
+ * This function gets the low power exit statistics of the radio driver.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WRadioGetWakeStats(K32WRadioWakeStats *aStats);
+
+/**
+ * This function resets the low power exit statistics of the radio driver.
+ *
+ */
+void K32WRadioResetWakeStats(void);
+
+/**
+ * This structure represents the usage of the radio driver RX ring buffer.
+ *
+ */
+typedef struct
+{
+    uint16_t depth;          ///< Number of RX buffers in the ring.
+    uint16_t peakOccupancy;  ///< Highest number of received frames waiting to be processed.
+    uint32_t frames;         ///< Number of frames pushed to the ring.
+    uint32_t overflows;      ///< Number of times the receiver was stopped because the ring was full.
+    uint64_t rxDisabledTime; ///< Cumulated time the receiver was stopped because the ring was full, in microseconds.
+} K32WRadioRxRingStats;
+
+/**
+ * This function gets the RX ring buffer statistics of the radio driver.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WRadioGetRxRingStats(K32WRadioRxRingStats *aStats);
+
+/**
+ * This function resets the RX ring buffer statistics of the radio driver.
+ *
+ */
+void K32WRadioResetRxRingStats(void);
+
+/**
+ * This enumeration defines the classes of received frames which can be dropped by the radio driver in
+ * interrupt context, before they use an RX ring entry.
+ *
+ */
+typedef enum
+{
+    K32W_RADIO_RX_FILTER_BEACON         = 1 << 0, ///< Beacon frames.
+    K32W_RADIO_RX_FILTER_BEACON_REQUEST = 1 << 1, ///< Beacon request MAC commands.
+    K32W_RADIO_RX_FILTER_BROADCAST      = 1 << 2, ///< Other frames sent to the broadcast short address.
+} K32WRadioRxFilter;
+
+/**
+ * This structure represents the frames dropped by the RX filter.
+ *
+ */
+typedef struct
+{
+    uint32_t beacons;        ///< Number of beacon frames dropped.
+    uint32_t beaconRequests; ///< Number of beacon request commands dropped.
+    uint32_t broadcasts;     ///< Number of other broadcast frames dropped.
+} K32WRadioRxFilterStats;
+
+/**
+ * This function sets the classes of received frames dropped by the radio driver. Nothing is dropped in
+ * promiscuous mode. The filter should be updated by the application on role changes and cleared for
+ * scans, K32WRadioGetRoleRxFilter() gives the frames not needed by a role.
+ *
+ * @param[in]  aFilter  Bitmap of K32WRadioRxFilter, 0 to receive all the frames.
+ *
+ */
+void K32WRadioSetRxFilter(uint8_t aFilter);
+
+/**
+ * This function gets the classes of received frames dropped by the radio driver.
+ *
+ * @returns Bitmap of K32WRadioRxFilter.
+ *
+ */
+uint8_t K32WRadioGetRxFilter(void);
+
+/**
+ * This function gets the classes of received frames a device role doesn't need.
+ *
+ * @param[in]  aRole        The device role.
+ * @param[in]  aIsScanning  TRUE if an active scan or a discovery is in progress.
+ *
+ * @returns Bitmap of K32WRadioRxFilter.
+ *
+ */
+uint8_t K32WRadioGetRoleRxFilter(otDeviceRole aRole, bool aIsScanning);
+
+/**
+ * This function gets the statistics of the RX filter.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WRadioGetRxFilterStats(K32WRadioRxFilterStats *aStats);
+
+/**
+ * This function resets the statistics of the RX filter.
+ *
+ */
+void K32WRadioResetRxFilterStats(void);
+
+/**
+ * @def K32W0_RADIO_STATS_ENABLE
+ *
+ * Define to 1 to enable the radio driver telemetry (K32WRadioGetStats() and the `radiostats` diag command).
+ *
+ */
+#ifndef K32W0_RADIO_STATS_ENABLE
+#define K32W0_RADIO_STATS_ENABLE 0
+#endif
+
+#if K32W0_RADIO_STATS_ENABLE
+/**
+ * This enumeration represents the radio driver states for which the residency is measured.
+ *
+ */
+typedef enum
+{
+    K32W_RADIO_STATS_STATE_DISABLED,    ///< OT_RADIO_STATE_DISABLED
+    K32W_RADIO_STATS_STATE_SLEEP,       ///< OT_RADIO_STATE_SLEEP
+    K32W_RADIO_STATS_STATE_RECEIVE,     ///< OT_RADIO_STATE_RECEIVE
+    K32W_RADIO_STATS_STATE_TRANSMIT,    ///< OT_RADIO_STATE_TRANSMIT
+    K32W_RADIO_STATS_STATE_RX_DISABLED, ///< Receive, with the receiver stopped because the RX ring is full
+    K32W_RADIO_STATS_STATE_ED_SCAN,     ///< Energy scan
+    K32W_RADIO_STATS_NUM_OF_STATES,
+} K32WRadioStatsState;
+
+/**
+ * This enumeration represents the TX errors reported by the MMAC (E_MMAC_TXSTAT bits).
+ *
+ */
+typedef enum
+{
+    K32W_RADIO_STATS_TX_CCA_BUSY, ///< E_MMAC_TXSTAT_CCA_BUSY
+    K32W_RADIO_STATS_TX_NO_ACK,   ///< E_MMAC_TXSTAT_NO_ACK
+    K32W_RADIO_STATS_TX_ABORTED,  ///< E_MMAC_TXSTAT_ABORTED
+    K32W_RADIO_STATS_TX_TXPCTO,   ///< E_MMAC_TXSTAT_TXPCTO
+    K32W_RADIO_STATS_TX_TXTO,     ///< E_MMAC_TXSTAT_TXTO
+    K32W_RADIO_STATS_NUM_OF_TX_ERRORS,
+} K32WRadioStatsTxError;
+
+/**
+ * The number of bins of the radio driver execution time histograms. Bin 0 counts the executions shorter
+ * than 256 CPU cycles, bin N the ones in [128 << N, 256 << N) and the last bin all the longer ones.
+ *
+ */
+#define K32W_RADIO_STATS_NUM_OF_BINS 8
+
+/**
+ * This structure represents the radio driver telemetry.
+ *
+ */
+typedef struct
+{
+    uint64_t stateTime[K32W_RADIO_STATS_NUM_OF_STATES]; ///< Time spent in each state, in microseconds.
+    uint32_t txAttempts;                                ///< Number of transmissions started.
+    uint32_t txSuccess;                                 ///< Number of transmissions completed without error.
+    uint32_t txErrors[K32W_RADIO_STATS_NUM_OF_TX_ERRORS]; ///< Number of transmissions failed, per TX error.
+    uint32_t rxAccepted;                                ///< Number of frames received without error.
+    uint32_t rxRejected;                                ///< Number of frames received with errors.
+    uint32_t isrHist[K32W_RADIO_STATS_NUM_OF_BINS];     ///< Radio interrupt handler execution time histogram.
+    uint32_t isrMaxCycles;                              ///< Longest radio interrupt handler execution, in CPU cycles.
+    uint32_t macHdrHist[K32W_RADIO_STATS_NUM_OF_BINS];  ///< MAC header processing execution time histogram.
+    uint32_t macHdrMaxCycles;                           ///< Longest MAC header processing, in CPU cycles.
+} K32WRadioStats;
+
+/**
+ * This function gets the telemetry of the radio driver. The frame pending lookups are reported by
+ * K32WRadioGetFpStats().
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WRadioGetStats(K32WRadioStats *aStats);
+
+/**
+ * This function resets the telemetry of the radio driver.
+ *
+ */
+void K32WRadioResetStats(void);
+#endif // K32W0_RADIO_STATS_ENABLE
+
+/**
+ * @def K32W0_RADIO_SNIFFER_ENABLE
+ *
+ * Define to 1 to enable the radio driver sniffer mode.
+ *
+ */
+#ifndef K32W0_RADIO_SNIFFER_ENABLE
+#define K32W0_RADIO_SNIFFER_ENABLE 0
+#endif
+
+#if K32W0_RADIO_SNIFFER_ENABLE
+/**
+ * This structure represents the frames captured in sniffer mode.
+ *
+ */
+typedef struct
+{
+    uint32_t frames;    ///< Number of frames captured.
+    uint32_t overflows; ///< Number of frames dropped because the capture ring was full.
+} K32WRadioSnifferStats;
+
+/**
+ * This function starts the sniffer mode. All the frames received on @p aChannel, without address
+ * filtering and without ACK, are kept in a dedicated ring and streamed as pcap records (IEEE 802.15.4
+ * TAP link type, with RSSI, LQI and channel) through K32WSnifferOutput(), starting with the pcap file
+ * header. The frames are not reported to OpenThread and transmissions are rejected.
+ *
+ * @param[in]  aChannel  The channel to capture.
+ *
+ * @retval OT_ERROR_NONE           The capture started.
+ * @retval OT_ERROR_INVALID_STATE  The radio is disabled or busy.
+ * @retval OT_ERROR_INVALID_ARGS   @p aChannel is not a valid channel.
+ *
+ */
+otError K32WRadioSnifferStart(uint8_t aChannel);
+
+/**
+ * This function stops the sniffer mode and streams the frames still in the capture ring.
+ *
+ */
+void K32WRadioSnifferStop(void);
+
+/**
+ * This function gets the sniffer mode statistics, reset when the sniffer mode starts.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WRadioGetSnifferStats(K32WRadioSnifferStats *aStats);
+
+/**
+ * This function outputs captured data. It is called from the radio driver processing and sends the
+ * data over the log UART (K32WWriteBlocking()) by default. It can be overridden to stream the capture
+ * over another interface (e.g.: SPI).
+ *
+ * @param[in]  aBuf  Buffer to be sent
+ * @param[in]  aLen  Length of the above buffer
+ *
+ */
+void K32WSnifferOutput(const uint8_t *aBuf, uint32_t aLen);
+#endif // K32W0_RADIO_SNIFFER_ENABLE
+
+/**
+ * This function adds a short address to the source match table of a PAN. The otPlatRadio source
+ * match functions act on the Thread PAN, these ones let another stack sharing the radio (e.g.: Zigbee)
+ * keep its own table. The frame pending bit of an ACK is set from the table of the destination PAN
+ * of the acknowledged frame.
+ *
+ * @param[in]  aPanId         The PAN ID.
+ * @param[in]  aShortAddress  The short address to be added.
+ *
+ * @retval OT_ERROR_NONE      Successfully added short address to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table or no table left for @p aPanId.
+ *
+ */
+otError K32WRadioAddSrcMatchShortEntry(uint16_t aPanId, uint16_t aShortAddress);
+
+/**
+ * This function adds an extended address to the source match table of a PAN.
+ *
+ * @param[in]  aPanId       The PAN ID.
+ * @param[in]  aExtAddress  The extended address to be added stored in little-endian byte order.
+ *
+ * @retval OT_ERROR_NONE      Successfully added extended address to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table or no table left for @p aPanId.
+ *
+ */
+otError K32WRadioAddSrcMatchExtEntry(uint16_t aPanId, const otExtAddress *aExtAddress);
+
+/**
+ * This function removes a short address from the source match table of a PAN.
+ *
+ * @param[in]  aPanId         The PAN ID.
+ * @param[in]  aShortAddress  The short address to be removed.
+ *
+ * @retval OT_ERROR_NONE        Successfully removed short address from the source match table.
+ * @retval OT_ERROR_NO_ADDRESS  The short address is not in the source match table.
+ *
+ */
+otError K32WRadioClearSrcMatchShortEntry(uint16_t aPanId, uint16_t aShortAddress);
+
+/**
+ * This function removes an extended address from the source match table of a PAN.
+ *
+ * @param[in]  aPanId       The PAN ID.
+ * @param[in]  aExtAddress  The extended address to be removed stored in little-endian byte order.
+ *
+ * @retval OT_ERROR_NONE        Successfully removed the extended address from the source match table.
+ * @retval OT_ERROR_NO_ADDRESS  The extended address is not in the source match table.
+ *
+ */
+otError K32WRadioClearSrcMatchExtEntry(uint16_t aPanId, const otExtAddress *aExtAddress);
+
+/**
+ * This function clears all short addresses from the source match table of a PAN.
+ *
+ * @param[in]  aPanId  The PAN ID.
+ *
+ */
+void K32WRadioClearSrcMatchShortEntries(uint16_t aPanId);
+
+/**
+ * This function clears all the extended addresses from the source match table of a PAN.
+ *
+ * @param[in]  aPanId  The PAN ID.
+ *
+ */
+void K32WRadioClearSrcMatchExtEntries(uint16_t aPanId);
+
 /**
  * This function initializes the random number service used by OpenThread.
  *
@@ -91,6 +453,60 @@ void K32WRandomInit(void);
  */
 void K32WUartProcess(void);
 
+/**
+ * This structure represents the receive path losses of the UART driver (UART_USE_DRIVER).
+ *
+ */
+typedef struct
+{
+    uint32_t overruns;         ///< Number of RX FIFO overruns, the FIFO content is lost.
+    uint32_t droppedBytes;     ///< Number of received bytes dropped because the RX buffer was full.
+    uint32_t overwrittenBytes; ///< Number of bytes the RX DMA may have overwritten while they were being parsed.
+    uint32_t flowOffs;         ///< Number of times RTS was released because the RX buffer reached its high level.
+    uint16_t maxLevel;         ///< Highest number of bytes waiting in the RX buffer.
+} K32WUartRxStats;
+
+/**
+ * This function gets the receive path statistics of the UART driver, all zero without UART_USE_DRIVER.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WUartGetRxStats(K32WUartRxStats *aStats);
+
+/**
+ * This function resets the receive path statistics of the UART driver.
+ *
+ */
+void K32WUartResetRxStats(void);
+
+/**
+ * This structure represents the DMA transmit queue of the UART driver (UART_USE_DRIVER_TX_DMA).
+ *
+ */
+typedef struct
+{
+    uint32_t buffersSent;   ///< Number of otPlatUartSend() buffers sent.
+    uint32_t bytesSent;     ///< Number of bytes sent.
+    uint32_t stalls;        ///< Number of otPlatUartSend() calls rejected because the queue was full.
+    uint8_t  queueDepth;    ///< Number of buffers currently queued, including the one being sent.
+    uint8_t  maxQueueDepth; ///< Highest number of buffers queued at once.
+} K32WUartTxStats;
+
+/**
+ * This function gets the DMA transmit queue statistics of the UART driver, all zero without UART_USE_DRIVER_TX_DMA.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are copied.
+ *
+ */
+void K32WUartGetTxStats(K32WUartTxStats *aStats);
+
+/**
+ * This function resets the DMA transmit queue statistics of the UART driver.
+ *
+ */
+void K32WUartResetTxStats(void);
+
 /**
  * This function initializes the platform defined logging.
  *
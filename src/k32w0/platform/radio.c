@@ -38,13 +38,19 @@
 /* memcpy */
 #include "string.h"
 
+/* offsetof */
+#include <stddef.h>
+
 /* uMac, MMAC, Radio */
 #include "MMAC.h"
 #include "MicroSpecific_arm_sdk2.h"
+#include "TimersManager.h"
+#include "fsl_device_registers.h"
 #include "radio.h"
 
 /* Openthread general */
 #include "openthread-system.h"
+#include "platform-k32w.h"
 #include <utils/encoding.h>
 #include <utils/code_utils.h>
 #include <utils/mac_frame.h>
@@ -78,10 +84,6 @@ extern void BOARD_GetCoexIoCfg(void **rfDeny, void **rfActive, void **rfStatus);
 #endif
 
 /* Defines */
-#define BIT_SET(arg, posn) ((arg) |= (1ULL << (posn)))
-#define BIT_CLR(arg, posn) ((arg) &= ~(1ULL << (posn)))
-#define BIT_TST(arg, posn) (!!((arg) & (1ULL << (posn))))
-
 #define ALL_FFs_BYTE (0xFF)
 
 #define K32W_RADIO_MIN_TX_POWER_DBM (-30)
@@ -93,9 +95,46 @@ extern void BOARD_GetCoexIoCfg(void **rfDeny, void **rfActive, void **rfStatus);
 #define SYMBOLS_TO_US(symbols) ((symbols)*US_PER_SYMBOL)
 #define US_TO_MILI_DIVIDER (1000)
 
-/* max number of SED children <= the size of address mask variable(s) */
+/* max number of SED children <= the size of the source match tables */
 #define MAX_FP_ADDRS MIN(OPENTHREAD_CONFIG_MLE_MAX_CHILDREN, 64)
 
+/* number of PANs with their own source match tables */
+#ifndef K32W0_RADIO_NUM_OF_FP_PANS
+#ifdef MAC_PROTO_TAG
+#define K32W0_RADIO_NUM_OF_FP_PANS (2) /* Thread + the co-existing stack */
+#else
+#define K32W0_RADIO_NUM_OF_FP_PANS (1)
+#endif
+#endif
+
+/* number of frame pending decisions kept for repeated polls, must be a power of 2 */
+#ifndef K32W0_RADIO_FP_CACHE_SIZE
+#define K32W0_RADIO_FP_CACHE_SIZE (8)
+#endif
+
+#if (K32W0_RADIO_FP_CACHE_SIZE & (K32W0_RADIO_FP_CACHE_SIZE - 1)) != 0
+#error "K32W0_RADIO_FP_CACHE_SIZE must be a power of 2"
+#endif
+
+#if K32W0_RADIO_STATS_ENABLE
+/* CPU cycle counter used for timing the code running in interrupt context.
+   Both macros can be provided by the build when the driver doesn't run on the
+   K32W core (e.g. against a simulated MMAC). */
+#ifndef K32W_CYCLES_NOW
+#define K32W_CYCLES_INIT()                              \
+    do                                                  \
+    {                                                   \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;            \
+    } while (0)
+#define K32W_CYCLES_NOW() (DWT->CYCCNT)
+#endif
+
+#define K32W_RADIO_STATS_INC(field) (sRadioStats.field++)
+#else
+#define K32W_RADIO_STATS_INC(field)
+#endif
+
 #ifndef K32W0_RADIO_NUM_OF_RX_BUFS
 #define K32W0_RADIO_NUM_OF_RX_BUFS (8) /* max number of RX buffers */
 #endif
@@ -104,6 +143,35 @@ extern void BOARD_GetCoexIoCfg(void **rfDeny, void **rfActive, void **rfStatus);
 #error "K32W0_RADIO_NUM_OF_RX_BUFS must be power of 2"
 #endif
 
+/* Optional linker section for the RX buffers (e.g. ".mac_buffer" for deep rings).
+   The MAC writes the received frames directly in these buffers, so the section
+   must be reachable by the MAC DMA. */
+#ifdef K32W0_RADIO_RX_BUFS_SECTION
+#define K32W0_RADIO_RX_BUFS_ATTR __attribute__((section(K32W0_RADIO_RX_BUFS_SECTION)))
+#else
+#define K32W0_RADIO_RX_BUFS_ATTR
+#endif
+
+#if K32W0_RADIO_SNIFFER_ENABLE
+#ifndef K32W0_RADIO_SNIFFER_NUM_OF_BUFS
+#define K32W0_RADIO_SNIFFER_NUM_OF_BUFS (32) /* number of sniffer RX buffers */
+#endif
+
+#if (K32W0_RADIO_SNIFFER_NUM_OF_BUFS) & (K32W0_RADIO_SNIFFER_NUM_OF_BUFS - 1)
+#error "K32W0_RADIO_SNIFFER_NUM_OF_BUFS must be power of 2"
+#endif
+
+#define PCAP_MAGIC (0xa1b2c3d4)
+#define PCAP_LINKTYPE_IEEE802_15_4_TAP (283)
+#define PCAP_SNAPLEN (0xffff)
+
+/* IEEE 802.15.4 TAP TLV types */
+#define TAP_TLV_FCS_TYPE (0)
+#define TAP_TLV_RSS (1)
+#define TAP_TLV_CHANNEL (3)
+#define TAP_TLV_LQI (10)
+#endif
+
 /* check IEEE Std. 802.15.4 - 2015: Table 8-81 - MAC sublayer constants */
 #ifndef MAC_TX_RETRIES
 #define MAC_TX_RETRIES (3)
@@ -140,23 +208,70 @@ extern void BOARD_GetCoexIoCfg(void **rfDeny, void **rfActive, void **rfStatus);
 
 #define TX_TO 544 /* symbols. 2 max length frames + AIFS */
 
+/* While receiving, otPlatRadioGetRssi() returns the latest channel energy measurement
+   if it is more recent than this, instead of stopping the receiver to measure it again.
+   The receiver is then stopped at most once per period. Frame RSSIs are not used, they
+   are not a measure of the channel energy. Set to 0 to always measure. */
+#ifndef K32W0_RADIO_RSSI_CACHE_TIME_US
+#define K32W0_RADIO_RSSI_CACHE_TIME_US (100000)
+#endif
+
+/* During an energy scan the RSSI is sampled once per this period, on the wake timer. */
+#ifndef K32W0_RADIO_ED_SCAN_SAMPLE_PERIOD_US
+#define K32W0_RADIO_ED_SCAN_SAMPLE_PERIOD_US (1000)
+#endif
+
+/* The mapping between the MMAC symbol clock and otPlatTimeGet() is resynced when the radio
+   driver is processed, at most once per this period. The drift is filtered over 2^SHIFT syncs. */
+#ifndef K32W0_RADIO_CLOCK_SYNC_PERIOD_US
+#define K32W0_RADIO_CLOCK_SYNC_PERIOD_US (1000000)
+#endif
+
+#define K32W_CLOCK_DRIFT_FILTER_SHIFT (2)
+#define K32W_CLOCK_MAX_DRIFT_PPM (500) /* larger deviations are taken as a clock restart */
+#define K32W_CLOCK_NOMINAL_SLOPE ((uint32_t)US_PER_SYMBOL << 16)
+#define K32W_CLOCK_MAX_DRIFT ((uint32_t)((uint64_t)K32W_CLOCK_NOMINAL_SLOPE * K32W_CLOCK_MAX_DRIFT_PPM / 1000000))
+
 #define CSL_UNCERT 255 ///< The Uncertainty of the scheduling CSL of transmission by the parent, in ±10 us units.
 
 /* RX was disabled due to no RX bufs */
 #define OT_RADIO_STATE_RX_DISABLED ((otRadioState)(OT_RADIO_STATE_INVALID - 1))
 
+/* Energy scan ongoing, see K32WProcessEnergyScan() */
+#define OT_RADIO_STATE_ED_SCAN ((otRadioState)(OT_RADIO_STATE_INVALID - 2))
+
 /* Structures */
+
+/* Frame Pending source match tables. The entries are kept sorted in ascending
+   order so K32WCheckIfFpRequired() can do a binary search in interrupt context */
+typedef struct
+{
+    uint16_t addr[MAX_FP_ADDRS];
+    uint8_t  num;
+} fpShortAddrTable;
+
+typedef struct
+{
+    uint64_t addr[MAX_FP_ADDRS]; /* native byte order */
+    uint8_t  num;
+} fpExtAddrTable;
+
 typedef struct
 {
-    uint16_t macAddress;
-    uint16_t panId;
-} fpNeighShortAddr;
+    uint16_t         panId; /* valid if inUse */
+    bool             inUse; /* false until the tables are assigned to a PAN */
+    fpShortAddrTable shortAddr;
+    fpExtAddrTable   extAddr;
+} fpPanTables;
 
 typedef struct
 {
-    otExtAddress extAddr;
-    uint16_t     panId;
-} fpNeighExtAddr;
+    uint64_t addr;         /* native byte order */
+    uint32_t generation;   /* sFpGeneration when the decision was taken */
+    uint16_t panId;        /* PAN ID of the tables looked up */
+    uint8_t  addrType;     /* otMacAddressType */
+    bool     isFpRequired; /* frame pending decision */
+} fpCacheEntry;
 
 typedef struct
 {
@@ -166,14 +281,73 @@ typedef struct
 
 typedef struct
 {
-    rxRingBufferEntry buffer[K32W0_RADIO_NUM_OF_RX_BUFS];
-    volatile uint16_t head;
-    volatile uint16_t tail;
-    volatile uint16_t next;
-    volatile uint16_t last;
-    volatile uint16_t ovf_cnt;
+    rxRingBufferEntry *buffer; /* K32W0_RADIO_NUM_OF_RX_BUFS entries */
+    volatile uint16_t  head;
+    volatile uint16_t  tail;
+    volatile uint16_t  next;
+    volatile uint16_t  last;
+    volatile bool_t    isRxDisabled;    /* RX stopped because the ring is full */
+    volatile uint32_t  rxDisabledStart; /* MMAC time (symbols) when RX was stopped */
 } rxRingBuffer;
 
+#if K32W0_RADIO_SNIFFER_ENABLE
+typedef struct
+{
+    tsPhyFrame f;         /* Written by the MAC DMA */
+    uint64_t   timestamp; /* RX time (us) */
+    int8_t     rssi;
+    uint8_t    lqi;
+    uint8_t    channel;
+} snifferEntry;
+
+typedef struct
+{
+    volatile uint16_t head; /* Entry being received */
+    volatile uint16_t tail; /* Oldest entry not yet streamed */
+} snifferRing;
+
+/* pcap file header, host byte order */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t versionMajor;
+    uint16_t versionMinor;
+    int32_t  thisZone;
+    uint32_t sigFigs;
+    uint32_t snapLen;
+    uint32_t linkType;
+} pcapFileHdr;
+
+/* pcap record header followed by the IEEE 802.15.4 TAP header (little endian) */
+typedef struct
+{
+    uint32_t tsSec;
+    uint32_t tsUsec;
+    uint32_t inclLen;
+    uint32_t origLen;
+
+    uint8_t  tapVersion;
+    uint8_t  tapReserved;
+    uint16_t tapLength;
+    uint16_t fcsType;
+    uint16_t fcsLength;
+    uint8_t  fcs;
+    uint8_t  fcsPad[3];
+    uint16_t rssType;
+    uint16_t rssLength;
+    float    rss;
+    uint16_t lqiType;
+    uint16_t lqiLength;
+    uint8_t  lqi;
+    uint8_t  lqiPad[3];
+    uint16_t channelType;
+    uint16_t channelLength;
+    uint16_t channel;
+    uint8_t  page;
+    uint8_t  channelPad;
+} pcapRecordHdr;
+#endif
+
 typedef enum
 {
     kFcsSize             = sizeof(uint16_t),
@@ -185,6 +359,10 @@ typedef enum
 
     kMacFcfLowOffset = 0, /* Offset of FCF first byte inside Mac Hdr */
     kMacFrameDataReq = 4,
+    kFcfSize         = sizeof(uint16_t),
+    kPanIdSize       = sizeof(uint16_t),
+    kShortAddrSize   = sizeof(uint16_t),
+    kExtAddrSize     = sizeof(uint64_t),
 
     kFcfTypeBeacon       = 0,
     kFcfTypeMacData      = 1,
@@ -192,9 +370,11 @@ typedef enum
     kFcfTypeMacCommand   = 3,
     kFcfMacFrameTypeMask = 7 << 0,
 
+    kFcfSecurityEnabled   = 1 << 3,
     kFcfAckRequest        = 1 << 5,
     kFcfPanidCompression  = 1 << 6,
     kFcfSeqNbSuppresssion = 1 << 8,
+    kFcfIePresent         = 1 << 9,
     kFcfDstAddrNone       = 0 << 10,
     kFcfDstAddrShort      = 2 << 10,
     kFcfDstAddrExt        = 3 << 10,
@@ -203,6 +383,8 @@ typedef enum
     kFcfSrcAddrShort      = 2 << 14,
     kFcfSrcAddrExt        = 3 << 14,
     kFcfSrcAddrMask       = 3 << 14,
+    kFcfFrameVersionMask  = 3 << 12,
+    kFcfFrameVersion2015  = 2 << 12,
 
     kSecLevelMask            = 7 << 0,
     kFrameCounterSuppression = 1 << 5,
@@ -213,6 +395,9 @@ typedef enum
     kKeyIdMode3    = 3 << 3,
     kKeyIdModeMask = 3 << 3,
 
+    kMacCmdBeaconRequest = 0x07,
+    kShortAddrBroadcast  = 0xffff,
+
     kKeySourceSizeMode0 = 0,
     kKeySourceSizeMode1 = 0,
     kKeySourceSizeMode2 = 4,
@@ -232,18 +417,60 @@ static void K32WProcessMacHeader(tsPhyFrame *aRxFrame);
 
 static void K32WProcessRxFrames(otInstance *aInstance);
 static void K32WProcessTxFrame(otInstance *aInstance);
+static void K32WProcessPendingRequests(void);
+static void K32WProcessEnergyScan(otInstance *aInstance);
+static void K32WEdScanTimerCallback(void);
+static void K32WEdScanScheduleSample(void);
+
+static bool_t K32WRxIsr(uint32_t u32IntBitmap);
+static void   K32WStartTransmit(void);
+static void   K32WTxCompleteIsr(void);
+static void   K32WApplyPendingChannel(void);
+
+static bool    K32WCheckIfFpRequired(tsPhyFrame *aRxFrame);
+static bool    K32WIsDstPanIdPresent(uint16_t aFcf);
+static uint8_t K32WFpShortAddrLowerBound(const fpShortAddrTable *aTable, uint16_t aShortAddress);
+static uint8_t K32WFpExtAddrLowerBound(const fpExtAddrTable *aTable, uint64_t aExtAddress);
+static void    K32WFpShortAddrRemove(fpShortAddrTable *aTable, uint8_t aIdx);
+static void    K32WFpExtAddrRemove(fpExtAddrTable *aTable, uint8_t aIdx);
 
-static bool K32WCheckIfFpRequired(tsPhyFrame *aRxFrame);
+static fpPanTables *K32WFpGetPanTables(uint16_t aPanId, bool aCreate);
 
 static void K32WFrameConversion(tsPhyFrame *aPhyFrame, otRadioFrame *aOtFrame);
+static bool K32WRxFilterDrop(tsPhyFrame *aRxFrame);
 
 static void               K32WResetRxRingBuffer();
+static void               K32WRxRingDisabledEnd();
 static void               K32WPushRxRingBuffer();
 static void               K32WPopRxRingBuffer();
 static rxRingBufferEntry *K32WGetRxRingBuffer();
 
 static void K32WEnableReceive();
 
+static void K32WSetState(otRadioState aState);
+#if K32W0_RADIO_STATS_ENABLE
+static void K32WStatsAccountState(void);
+static void K32WStatsAddCycles(uint32_t *aHist, uint32_t *aMaxCycles, uint32_t aCycles);
+#endif
+
+static void K32WModemSetChannelAndPower(uint8_t aChannel, int8_t aPower);
+static void K32WModemSetPanId(uint16_t aPanId);
+static void K32WModemSetShortAddr(uint16_t aShortAddress);
+static void K32WModemSetExtAddr(const tsExtAddr *aExtAddress);
+
+#if K32W0_RADIO_SNIFFER_ENABLE
+static void   K32WSnifferEnableReceive(void);
+static bool_t K32WSnifferRxIsr(uint32_t u32IntBitmap);
+static void   K32WProcessSnifferFrames(void);
+#endif
+
+static void     K32WClockSync(void);
+static uint64_t K32WClockSymbolsToUs(uint32_t aSymbols);
+static int64_t  K32WClockUsDeltaQ4(uint32_t aUs);
+
+static bool_t K32WRssiCacheIsValid(void);
+static void   K32WRssiCacheUpdate(int8_t aRssi);
+
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 static void K32WEncFrame(void *t, const void *key);
 
@@ -272,14 +499,15 @@ static uint64_t  sCustomExtAddr = 0;
 static otExtAddress sRevExtAddr;
 #endif
 
-static fpNeighShortAddr sFpShortAddr[MAX_FP_ADDRS]; /* Frame Pending short addresses array */
-static uint64_t         sFpShortAddrMask;           /* Mask - sFpShortAddr valid entries */
-
-static fpNeighExtAddr sFpExtAddr[MAX_FP_ADDRS]; /* Frame Pending extended addresses array */
-static uint64_t       sFpExtAddrMask;           /* Mask - sFpExtAddr is valid */
+static fpPanTables      sFpPans[K32W0_RADIO_NUM_OF_FP_PANS]; /* Frame Pending tables, per PAN */
+static K32WRadioFpStats sFpStats;                            /* Frame Pending lookup statistics */
+static fpCacheEntry     sFpCache[K32W0_RADIO_FP_CACHE_SIZE]; /* Latest Frame Pending decisions, per source */
+static uint32_t         sFpGeneration = 1;                   /* Incremented when the tables change */
 
-static rxRingBuffer sRxRing;                       /* Receive Ring Buffer */
-static teRxOption   sRxOpt = E_MMAC_RX_START_NOW | /* RX Options */
+static rxRingBufferEntry    sRxRingEntries[K32W0_RADIO_NUM_OF_RX_BUFS] K32W0_RADIO_RX_BUFS_ATTR;
+static rxRingBuffer         sRxRing = {.buffer = sRxRingEntries}; /* Receive Ring Buffer */
+static K32WRadioRxRingStats sRxRingStats;                         /* Receive Ring Buffer statistics */
+static teRxOption           sRxOpt = E_MMAC_RX_START_NOW | /* RX Options */
                            E_MMAC_RX_ALIGN_NORMAL | E_MMAC_RX_USE_AUTO_ACK | E_MMAC_RX_NO_MALFORMED |
                            E_MMAC_RX_NO_FCS_ERROR | E_MMAC_RX_ADDRESS_MATCH;
 
@@ -289,13 +517,100 @@ static otRadioFrame sAckOtFrame; /* Used for ACK frame conversion */
 
 static bool_t       sRadioInitForLp    = FALSE;
 static bool_t       sPromiscuousEnable = FALSE;
-static bool_t       sTxDone;    /* TRUE if a TX frame was sent into the air */
-static otError      sTxStatus;  /* Status of the latest TX operation */
-static otRadioFrame sTxOtFrame; /* OT TX Frame to be send */
+static bool_t       sTxDone;            /* TRUE if a TX frame was sent into the air */
+static otError      sTxStatus;          /* Status of the latest TX operation */
+static otRadioFrame sTxOtFrame;         /* OT TX Frame to be send */
+static teTxOption   sTxOptions;         /* MMAC options of the TX Frame */
+static uint32_t     sTxTime;            /* Start time (symbols) of a delayed TX Frame */
+static uint8_t      sTxMaxFrameRetries; /* Retransmissions done by the MMAC if not acknowledged */
+static uint32_t     sAckTimestamp;      /* MMAC time (symbols) of the ACK, latched by K32WTxCompleteIsr() */
+static uint8_t      sAckLqi;            /* LQI of the ACK, latched by K32WTxCompleteIsr() */
+static int8_t       sAckRssi;           /* RSSI of the ACK, latched by K32WTxCompleteIsr() */
+
+static volatile uint8_t       sRxFilter;      /* K32WRadioRxFilter bitmap of the frames dropped in K32WRxIsr() */
+static K32WRadioRxFilterStats sRxFilterStats; /* Frames dropped by the RX filter */
+static bool_t                 sIsRxDropped;   /* the last RX complete interrupt was a dropped frame */
+
+/* Requests deferred until the end of an ongoing reception, started from K32WISR() */
+static volatile bool_t  sTxPending;        /* TX Frame waiting for the RX to complete */
+static volatile uint8_t sRxPendingChannel; /* RX channel to switch to, 0 if none */
+static uint32_t         sPendingStart;     /* MMAC time (symbols) when the request was deferred */
+
+static otRadioState                 sEdScanPrevState;   /* Radio state to restore at the end of the energy scan */
+static uint8_t                      sEdScanPrevChannel; /* Channel to restore at the end of the energy scan */
+static uint64_t                     sEdScanEnd;         /* otPlatTimeGet() deadline of the energy scan */
+static int16_t                      sEdScanMaxRssi;     /* Highest RSSI sampled during the energy scan */
+static volatile bool_t              sEdScanSampleDue;   /* Set by the energy scan timer */
+static TMR_tsActivityWakeTimerEvent sEdScanTimer;       /* Wakes the driver for the next RSSI sample */
+
+#if K32W0_RADIO_SNIFFER_ENABLE
+static snifferEntry          sSnifferEntries[K32W0_RADIO_SNIFFER_NUM_OF_BUFS] K32W0_RADIO_RX_BUFS_ATTR;
+static snifferRing           sSnifferRing;
+static K32WRadioSnifferStats sSnifferStats;
+static bool_t                sIsSnifferEnabled;
+/* Sniffer RX Options: no address filtering and no ACK */
+static const teRxOption sSnifferRxOpt = E_MMAC_RX_START_NOW | E_MMAC_RX_ALIGN_NORMAL | E_MMAC_RX_NO_MALFORMED |
+                                        E_MMAC_RX_NO_FCS_ERROR;
+#endif
+
+#if K32W0_RADIO_STATS_ENABLE
+static K32WRadioStats sRadioStats;      /* Radio driver telemetry */
+static uint64_t       sStatsStateStart; /* Time (us) when sState was entered or last accounted */
+#endif
+
+static int8_t   sRssiCache = OT_RADIO_RSSI_INVALID; /* Latest channel energy measured (dBm) */
+static uint8_t  sRssiCacheChannel;                  /* Channel of sRssiCache */
+static uint32_t sRssiCacheTime;                     /* MMAC time (symbols) of sRssiCache */
+
+/* Linear mapping of the MMAC symbol clock to otPlatTimeGet(): us = anchorUs + (symbols - anchorSym) * slope */
+static struct
+{
+    uint32_t anchorSym;   /* MMAC time (symbols) of the last sync */
+    uint64_t anchorUs;    /* otPlatTimeGet() of the last sync */
+    uint64_t nextSyncUs;  /* otPlatTimeGet() from which the next sync is done */
+    uint32_t slopeQ16;    /* us per symbol, Q16 */
+    uint32_t symPerUsQ32; /* 1 / slope, symbols per us, Q32 */
+    bool     isValid;
+} sClockMap;
+
+/* Modem configuration last written to the radio, only the settings which differ are written.
+ * The radio registers are not retained in low power, so the shadow is invalidated by otPlatRadioEnable().
+ */
+typedef enum
+{
+    kModemChannelAndPower = 1 << 0,
+    kModemPanId           = 1 << 1,
+    kModemShortAddr       = 1 << 2,
+    kModemExtAddr         = 1 << 3,
+} modemSetting;
+
+static struct
+{
+    uint8_t   channel;
+    int8_t    power;
+    uint16_t  panId;
+    uint16_t  shortAddr;
+    tsExtAddr extAddr;
+    uint8_t   validMask; /* modemSetting bitmap of the settings known to be in the radio */
+} sModemShadow;
+
+static K32WRadioWakeStats sWakeStats;     /* low power exit statistics */
+static uint64_t           sWakeStart;     /* otPlatTimeGet() at low power exit */
+static bool_t             sIsWakePending; /* TRUE from sWakeStart until RX is enabled */
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 static uint32_t sMacFrameCounter;
 static uint8_t  sKeyId;
+
+#if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
+/* Enhanced ACK probing IE computed by K32WGetVsIeLen() for K32WGetVsIeGen() */
+static struct
+{
+    const void *frame; /* frame the IE was computed for, NULL if none */
+    uint8_t     ie[OT_ACK_IE_MAX_SIZE];
+    uint8_t     len;
+} sEnhAckIe;
+#endif
 #endif
 
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
@@ -307,6 +622,14 @@ static bool_t sAllowDeviceToSleep = TRUE;
 
 #if OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE
 static bool isCoexInitialized;
+
+static otRadioCoexMetrics sCoexMetrics; /* Coexistence metrics */
+static mwsRfState_t       sCoexState;   /* RF access currently granted */
+
+static mwsStatus_t K32WCoexRequestAccess(mwsRfState_t aState);
+static mwsStatus_t K32WCoexChangeAccess(mwsRfState_t aState);
+static void        K32WCoexReleaseAccess(void);
+static void        K32WCoexUpdateMetrics(mwsRfState_t aState, mwsStatus_t aStatus, bool aIsChange);
 #endif
 
 /* Stub functions for controlling low power mode */
@@ -346,6 +669,19 @@ void App_SetCustomEui64(uint8_t *aIeeeEui64)
 
 void K32WRadioInit(void)
 {
+#if K32W0_RADIO_STATS_ENABLE
+    /* Enable the CPU cycle counter used for measuring the ISR cost */
+    K32W_CYCLES_INIT();
+#endif
+
+    sEdScanTimer.u8Status = TMR_E_ACTIVITY_FREE;
+
+    /* Frame Pending tables initialization */
+    for (int i = 0; i < K32W0_RADIO_NUM_OF_FP_PANS; i++)
+    {
+        sFpPans[i].inUse = false;
+    }
+
     /* RX initialization */
     for (int i = 0; i < K32W0_RADIO_NUM_OF_RX_BUFS; i++)
     {
@@ -364,15 +700,26 @@ void K32WRadioInit(void)
 
 void K32WRadioProcess(otInstance *aInstance)
 {
+    if (sState != OT_RADIO_STATE_DISABLED)
+    {
+        K32WClockSync();
+    }
+
+    K32WProcessPendingRequests();
+    K32WProcessEnergyScan(aInstance);
     K32WProcessRxFrames(aInstance);
     K32WProcessTxFrame(aInstance);
+#if K32W0_RADIO_SNIFFER_ENABLE
+    K32WProcessSnifferFrames();
+#endif
 }
 
 otRadioState otPlatRadioGetState(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    return sState;
+    /* the energy scan is internal to the driver, the receiver is restored at its end */
+    return (sState == OT_RADIO_STATE_ED_SCAN) ? OT_RADIO_STATE_RECEIVE : sState;
 }
 
 void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
@@ -397,8 +744,23 @@ void otPlatRadioSetPanId(otInstance *aInstance, uint16_t aPanId)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
+    fpPanTables *pan;
+
+    OSA_InterruptDisable();
+
+    /* the source match entries of the Thread PAN follow its PAN ID */
+    pan = K32WFpGetPanTables(sPanId, false);
+
+    if ((pan != NULL) && (K32WFpGetPanTables(aPanId, false) == NULL))
+    {
+        pan->panId = aPanId;
+        sFpGeneration++;
+    }
+
     sPanId = aPanId;
-    vMMAC_SetRxPanId(aPanId);
+    K32WModemSetPanId(aPanId);
+
+    OSA_InterruptEnable();
 }
 
 void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
@@ -409,7 +771,7 @@ void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aE
     {
         memcpy(&sExtAddress.u32L, aExtAddress->m8, sizeof(uint32_t));
         memcpy(&sExtAddress.u32H, aExtAddress->m8 + sizeof(uint32_t), sizeof(uint32_t));
-        vMMAC_SetRxExtendedAddr(&sExtAddress);
+        K32WModemSetExtAddr(&sExtAddress);
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
         for (size_t i = 0; i < sizeof(*aExtAddress); i++)
@@ -425,7 +787,7 @@ void otPlatRadioSetShortAddress(otInstance *aInstance, uint16_t aShortAddress)
     OT_UNUSED_VARIABLE(aInstance);
 
     sShortAddress = aShortAddress;
-    vMMAC_SetRxShortAddr(aShortAddress);
+    K32WModemSetShortAddr(aShortAddress);
 }
 
 otError otPlatRadioEnable(otInstance *aInstance)
@@ -434,12 +796,26 @@ otError otPlatRadioEnable(otInstance *aInstance)
 
     sAllowDeviceToSleep = TRUE; /* synced with radio state */
 
+    if (sRadioInitForLp)
+    {
+        /* wake-to-RX latency, ends in K32WEnableReceive() */
+        sWakeStart     = otPlatTimeGet();
+        sIsWakePending = TRUE;
+        sWakeStats.wakeups++;
+    }
+
+    /* the MMAC clock may have been stopped */
+    sClockMap.isValid = FALSE;
+
     K32WResetRxRingBuffer();
 
     V2MMAC_Enable();
     V2MMAC_RegisterIntHandler(K32WISR);
     vMMAC_ConfigureRadio();
 
+    /* the radio registers are lost in low power and reset by the configuration above */
+    sModemShadow.validMask = 0;
+
     /* Exit from low power and / or already initialized.
      * Cover the case when otPlatRadioSleep() / otPlatRadioEnable() is not used to enter / exit low power
      * but otPlatRadioDisable() / otPlatRadioEnable() because it's done from outside the OT stack.
@@ -449,10 +825,10 @@ otError otPlatRadioEnable(otInstance *aInstance)
         sRadioInitForLp = FALSE;
 
         /* Re-set modem settings after low power exit */
-        vMMAC_SetChannelAndPower(sChannel, sTxPwrLevel);
-        vMMAC_SetRxExtendedAddr(&sExtAddress);
-        vMMAC_SetRxPanId(sPanId);
-        vMMAC_SetRxShortAddr(sShortAddress);
+        K32WModemSetChannelAndPower(sChannel, sTxPwrLevel);
+        K32WModemSetExtAddr(&sExtAddress);
+        K32WModemSetPanId(sPanId);
+        K32WModemSetShortAddr(sShortAddress);
     }
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -466,7 +842,7 @@ otError otPlatRadioEnable(otInstance *aInstance)
 #endif
 
     sInstance = aInstance;
-    sState    = OT_RADIO_STATE_SLEEP;
+    K32WSetState(OT_RADIO_STATE_SLEEP);
 
     return OT_ERROR_NONE;
 }
@@ -480,8 +856,15 @@ otError otPlatRadioDisable(otInstance *aInstance)
     /* stop the radio so there are no pending interrupts */
     vMMAC_RadioToOffAndWait();
 
-    sState = OT_RADIO_STATE_DISABLED;
+    K32WSetState(OT_RADIO_STATE_DISABLED);
+    sRxPendingChannel = 0;
+    sTxPending        = FALSE;
+
+    /* an ongoing energy scan is abandoned */
+    TMR_eRemoveActivity(&sEdScanTimer);
+    sEdScanSampleDue = FALSE;
 
+    K32WRxRingDisabledEnd();
     K32WResetRxRingBuffer();
 
     vMMAC_Disable();
@@ -503,7 +886,8 @@ otError otPlatRadioSleep(otInstance *aInstance)
     OT_UNUSED_VARIABLE(aInstance);
     otError status = OT_ERROR_NONE;
 
-    otEXPECT_ACTION(((sState != OT_RADIO_STATE_TRANSMIT) && (sState != OT_RADIO_STATE_DISABLED)),
+    otEXPECT_ACTION(((sState != OT_RADIO_STATE_TRANSMIT) && (sState != OT_RADIO_STATE_DISABLED) &&
+                     (sState != OT_RADIO_STATE_ED_SCAN)),
                     status = OT_ERROR_INVALID_STATE);
 
     /* The radio has been init and configuration should be restored in otPlatRadioEnable when
@@ -512,8 +896,10 @@ otError otPlatRadioSleep(otInstance *aInstance)
 
     /* stop the radio so there are no pending interrupts */
     vMMAC_RadioToOffAndWait();
+    K32WApplyPendingChannel();
 
-    sState = OT_RADIO_STATE_SLEEP;
+    K32WSetState(OT_RADIO_STATE_SLEEP);
+    K32WRxRingDisabledEnd();
 
     /* prevent multiple calls to the allow to sleep callback */
     if (FALSE == sAllowDeviceToSleep)
@@ -531,26 +917,16 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError  error  = OT_ERROR_NONE;
-    uint32_t txTime = 0;
+    otError error = OT_ERROR_NONE;
+    uint8_t channel;
 
-    otEXPECT_ACTION(((sState != OT_RADIO_STATE_TRANSMIT) && (sState != OT_RADIO_STATE_DISABLED)),
+    otEXPECT_ACTION(((sState != OT_RADIO_STATE_TRANSMIT) && (sState != OT_RADIO_STATE_DISABLED) &&
+                     (sState != OT_RADIO_STATE_ED_SCAN)),
                     error = OT_ERROR_INVALID_STATE);
 
-    /* Already in Rx on the same channel */
-    otEXPECT((sChannel != aChannel) || ((OT_RADIO_STATE_RECEIVE != sState) && (OT_RADIO_STATE_RX_DISABLED != sState)));
-
-    /* wait for Rx to finish */
-    txTime = u32MMAC_GetTime();
-
-    while (v2MAC_is_rx_ongoing() && ((u32MMAC_GetTime() - txTime) < TX_TO))
-    {
-    }
-
-    /* stop the radio so there are no pending interrupts */
-    vMMAC_RadioToOffAndWait();
-
-    sState = OT_RADIO_STATE_RECEIVE;
+    /* Already in Rx on the same channel (or switching to it) */
+    channel = sRxPendingChannel ? sRxPendingChannel : sChannel;
+    otEXPECT((channel != aChannel) || ((OT_RADIO_STATE_RECEIVE != sState) && (OT_RADIO_STATE_RX_DISABLED != sState)));
 
     /* prevent multiple calls to the allow to sleep callback */
     if (TRUE == sAllowDeviceToSleep)
@@ -560,9 +936,27 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
         RADIO_LOG("App_DisallowDeviceToSleep");
     }
 
-    sChannel = aChannel;
-    vMMAC_SetChannelAndPower(sChannel, sTxPwrLevel);
-    K32WEnableReceive();
+    OSA_InterruptDisable();
+
+    if ((OT_RADIO_STATE_RECEIVE == sState) && v2MAC_is_rx_ongoing())
+    {
+        /* Don't abort the ongoing Rx. The channel is changed by K32WISR() at the end of it */
+        sRxPendingChannel = (sChannel != aChannel) ? aChannel : 0;
+        sPendingStart     = u32MMAC_GetTime();
+    }
+    else
+    {
+        /* stop the radio so there are no pending interrupts */
+        vMMAC_RadioToOffAndWait();
+
+        K32WSetState(OT_RADIO_STATE_RECEIVE);
+        sRxPendingChannel = 0;
+        sChannel          = aChannel;
+        K32WModemSetChannelAndPower(sChannel, sTxPwrLevel);
+        K32WEnableReceive();
+    }
+
+    OSA_InterruptEnable();
 
 exit:
     return error;
@@ -579,211 +973,325 @@ otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, const uint16_t a
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError error = OT_ERROR_NO_BUFS;
-    uint8_t idx   = 0;
-
-    for (; idx < MAX_FP_ADDRS; idx++)
-    {
-        if (!BIT_TST(sFpShortAddrMask, idx))
-        {
-            sFpShortAddr[idx].panId      = sPanId;
-            sFpShortAddr[idx].macAddress = aShortAddress;
-            BIT_SET(sFpShortAddrMask, idx);
-            error = OT_ERROR_NONE;
-            break;
-        }
-    }
-
-    return error;
+    return K32WRadioAddSrcMatchShortEntry(sPanId, aShortAddress);
 }
 
 otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError      error = OT_ERROR_NO_BUFS;
-    uint8_t      idx   = 0;
-    otExtAddress tmp;
-
-    /* K32WCheckIfFpRequired() uses reversed addresses (big endian) */
-    for (size_t i = 0; i < sizeof(*aExtAddress); i++)
-    {
-        tmp.m8[i] = aExtAddress->m8[sizeof(*aExtAddress) - 1 - i];
-    }
-
-    for (; idx < MAX_FP_ADDRS; idx++)
-    {
-        if (!BIT_TST(sFpExtAddrMask, idx))
-        {
-            sFpExtAddr[idx].panId   = sPanId;
-            sFpExtAddr[idx].extAddr = tmp;
-            BIT_SET(sFpExtAddrMask, idx);
-            error = OT_ERROR_NONE;
-            break;
-        }
-    }
-
-    return error;
+    return K32WRadioAddSrcMatchExtEntry(sPanId, aExtAddress);
 }
 
 otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, const uint16_t aShortAddress)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError error = OT_ERROR_NO_ADDRESS;
-    uint8_t idx   = 0;
-
-    for (; idx < MAX_FP_ADDRS; idx++)
-    {
-        if (BIT_TST(sFpShortAddrMask, idx) && (sFpShortAddr[idx].macAddress == aShortAddress))
-        {
-            BIT_CLR(sFpShortAddrMask, idx);
-            error = OT_ERROR_NONE;
-            break;
-        }
-    }
-
-    return error;
+    return K32WRadioClearSrcMatchShortEntry(sPanId, aShortAddress);
 }
 
 otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError      error = OT_ERROR_NO_ADDRESS;
-    uint8_t      idx   = 0;
-    otExtAddress tmp;
-
-    /* K32WCheckIfFpRequired() uses reversed addresses (big endian) */
-    for (size_t i = 0; i < sizeof(*aExtAddress); i++)
-    {
-        tmp.m8[i] = aExtAddress->m8[sizeof(*aExtAddress) - 1 - i];
-    }
-
-    uint64_t v = otEncodingReadUint64Le(tmp.m8);
-
-    for (; idx < MAX_FP_ADDRS; idx++)
-    {
-        uint64_t t = otEncodingReadUint64Le(sFpExtAddr[idx].extAddr.m8);
-
-        if (BIT_TST(sFpExtAddrMask, idx) && (t == v))
-        {
-            BIT_CLR(sFpExtAddrMask, idx);
-            error = OT_ERROR_NONE;
-            break;
-        }
-    }
-
-    return error;
+    return K32WRadioClearSrcMatchExtEntry(sPanId, aExtAddress);
 }
 
 void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    sFpShortAddrMask = 0;
+    K32WRadioClearSrcMatchShortEntries(sPanId);
 }
 
 void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    sFpExtAddrMask = 0;
+    K32WRadioClearSrcMatchExtEntries(sPanId);
 }
 
-otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+otError K32WRadioAddSrcMatchShortEntry(uint16_t aPanId, uint16_t aShortAddress)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    otError      error = OT_ERROR_NONE;
+    fpPanTables *pan;
+    uint8_t      idx;
 
-    return &sTxOtFrame;
+    /* the tables are also read by K32WCheckIfFpRequired() in interrupt context */
+    OSA_InterruptDisable();
+
+    pan = K32WFpGetPanTables(aPanId, true);
+    otEXPECT_ACTION((pan != NULL) && (pan->shortAddr.num < MAX_FP_ADDRS), error = OT_ERROR_NO_BUFS);
+
+    idx = K32WFpShortAddrLowerBound(&pan->shortAddr, aShortAddress);
+    memmove(&pan->shortAddr.addr[idx + 1], &pan->shortAddr.addr[idx],
+            (pan->shortAddr.num - idx) * sizeof(pan->shortAddr.addr[0]));
+    pan->shortAddr.addr[idx] = aShortAddress;
+    pan->shortAddr.num++;
+    sFpGeneration++;
+
+exit:
+    OSA_InterruptEnable();
+    return error;
 }
 
-otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+otError K32WRadioAddSrcMatchExtEntry(uint16_t aPanId, const otExtAddress *aExtAddress)
 {
-    otError    error    = OT_ERROR_NONE;
-    teTxOption eOptions = E_MMAC_TX_USE_AUTO_ACK;
-    uint32_t   txTime   = 0;
+    otError      error = OT_ERROR_NONE;
+    uint64_t     v     = otEncodingReadUint64Le(aExtAddress->m8); /* aExtAddress is little endian */
+    fpPanTables *pan;
+    uint8_t      idx;
 
-    otEXPECT_ACTION((OT_RADIO_STATE_SLEEP == sState) || (OT_RADIO_STATE_RECEIVE == sState) ||
-                        (OT_RADIO_STATE_RX_DISABLED == sState),
-                    error = OT_ERROR_INVALID_STATE);
+    /* the tables are also read by K32WCheckIfFpRequired() in interrupt context */
+    OSA_InterruptDisable();
 
-    /* wait for Rx to finish */
-    txTime = u32MMAC_GetTime();
+    pan = K32WFpGetPanTables(aPanId, true);
+    otEXPECT_ACTION((pan != NULL) && (pan->extAddr.num < MAX_FP_ADDRS), error = OT_ERROR_NO_BUFS);
 
-    while (v2MAC_is_rx_ongoing() && ((u32MMAC_GetTime() - txTime) < TX_TO))
-    {
-    }
-    txTime = 0;
+    idx = K32WFpExtAddrLowerBound(&pan->extAddr, v);
+    memmove(&pan->extAddr.addr[idx + 1], &pan->extAddr.addr[idx],
+            (pan->extAddr.num - idx) * sizeof(pan->extAddr.addr[0]));
+    pan->extAddr.addr[idx] = v;
+    pan->extAddr.num++;
+    sFpGeneration++;
 
-    /* stop the radio so there are no pending interrupts */
-    vMMAC_RadioToOffAndWait();
+exit:
+    OSA_InterruptEnable();
+    return error;
+}
 
-    /* go to TX state */
-    sState    = OT_RADIO_STATE_TRANSMIT;
-    sTxStatus = OT_ERROR_NONE;
+otError K32WRadioClearSrcMatchShortEntry(uint16_t aPanId, uint16_t aShortAddress)
+{
+    otError      error = OT_ERROR_NO_ADDRESS;
+    fpPanTables *pan   = K32WFpGetPanTables(aPanId, false);
+    uint8_t      idx;
 
-    /* prevent multiple calls to the allow to sleep callback */
-    if (TRUE == sAllowDeviceToSleep)
+    otEXPECT(pan != NULL);
+
+    idx = K32WFpShortAddrLowerBound(&pan->shortAddr, aShortAddress);
+
+    if ((idx < pan->shortAddr.num) && (pan->shortAddr.addr[idx] == aShortAddress))
     {
-        App_DisallowDeviceToSleep();
-        sAllowDeviceToSleep = FALSE;
-        RADIO_LOG("App_DisallowDeviceToSleep");
+        K32WFpShortAddrRemove(&pan->shortAddr, idx);
+        error = OT_ERROR_NONE;
     }
 
-#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-    if (otMacFrameIsSecurityEnabled(aFrame) && otMacFrameIsKeyIdMode1(aFrame) &&
-        !aFrame->mInfo.mTxInfo.mIsSecurityProcessed)
-    {
-        /* Encryption is done by MAC */
-        eOptions |= E_MMAC_TX_ENC;
+exit:
+    return error;
+}
 
-        if (!aFrame->mInfo.mTxInfo.mIsHeaderUpdated)
-        {
-            /* the header can be updated with frame counter, keyId and CSL IE */
-            eOptions |= E_MMAC_TX_HDR_UPD;
-        }
-    }
+otError K32WRadioClearSrcMatchExtEntry(uint16_t aPanId, const otExtAddress *aExtAddress)
+{
+    otError      error = OT_ERROR_NO_ADDRESS;
+    uint64_t     v     = otEncodingReadUint64Le(aExtAddress->m8); /* aExtAddress is little endian */
+    fpPanTables *pan   = K32WFpGetPanTables(aPanId, false);
+    uint8_t      idx;
 
-    if (aFrame->mInfo.mTxInfo.mTxDelay)
-    {
-        eOptions |= E_MMAC_TX_USE_CCA | E_MMAC_TX_DELAY_START;
+    otEXPECT(pan != NULL);
 
-        /* txTime is in the future. Convert it to symbol time */
-        txTime = aFrame->mInfo.mTxInfo.mTxDelay + aFrame->mInfo.mTxInfo.mTxDelayBaseTime;
-        txTime = u32MMAC_GetTime() + (txTime - (uint32_t)otPlatTimeGet()) / US_PER_SYMBOL;
-    }
-    else
-#endif
+    idx = K32WFpExtAddrLowerBound(&pan->extAddr, v);
+
+    if ((idx < pan->extAddr.num) && (pan->extAddr.addr[idx] == v))
     {
-        eOptions |= E_MMAC_TX_START_NOW;
+        K32WFpExtAddrRemove(&pan->extAddr, idx);
+        error = OT_ERROR_NONE;
     }
 
-    /* set tx channel */
-    if (sChannel != aFrame->mChannel)
-    {
-        /* after tx ends, rx on the same channel */
-        sChannel = aFrame->mChannel;
+exit:
+    return error;
+}
 
-        vMMAC_SetChannelAndPower(aFrame->mChannel, sTxPwrLevel);
-    }
+void K32WRadioClearSrcMatchShortEntries(uint16_t aPanId)
+{
+    fpPanTables *pan = K32WFpGetPanTables(aPanId, false);
 
-    if (aFrame->mInfo.mTxInfo.mCsmaCaEnabled)
+    if (pan != NULL)
     {
-        eOptions |= E_MMAC_TX_USE_CCA;
+        pan->shortAddr.num = 0;
+        sFpGeneration++;
     }
+}
 
-    if (eOptions & E_MMAC_TX_USE_CCA)
+void K32WRadioClearSrcMatchExtEntries(uint16_t aPanId)
+{
+    fpPanTables *pan = K32WFpGetPanTables(aPanId, false);
+
+    if (pan != NULL)
     {
-        if ((eOptions & E_MMAC_TX_DELAY_START) == E_MMAC_TX_DELAY_START)
-        {
-            /* No retransmissions, just 1 CCA */
-            vMMAC_SetTxParameters(1, 0, 0, 0);
-        }
-        else
-        {
-            vMMAC_SetTxParameters(1, MAC_TX_CSMA_MIN_BE, MAC_TX_CSMA_MAX_BE, aFrame->mInfo.mTxInfo.mMaxCsmaBackoffs);
-        }
+        pan->extAddr.num = 0;
+        sFpGeneration++;
+    }
+}
+
+void K32WRadioGetFpStats(K32WRadioFpStats *aStats)
+{
+    OSA_InterruptDisable();
+    *aStats = sFpStats;
+    OSA_InterruptEnable();
+}
+
+void K32WRadioResetFpStats(void)
+{
+    OSA_InterruptDisable();
+    memset(&sFpStats, 0, sizeof(sFpStats));
+    OSA_InterruptEnable();
+}
+
+void K32WRadioGetWakeStats(K32WRadioWakeStats *aStats)
+{
+    OSA_InterruptDisable();
+    *aStats = sWakeStats;
+    OSA_InterruptEnable();
+}
+
+void K32WRadioResetWakeStats(void)
+{
+    OSA_InterruptDisable();
+    memset(&sWakeStats, 0, sizeof(sWakeStats));
+    OSA_InterruptEnable();
+}
+
+void K32WRadioGetRxRingStats(K32WRadioRxRingStats *aStats)
+{
+    OSA_InterruptDisable();
+
+    *aStats       = sRxRingStats;
+    aStats->depth = K32W0_RADIO_NUM_OF_RX_BUFS;
+
+    /* account for an ongoing RX disabled period */
+    if (sRxRing.isRxDisabled)
+    {
+        aStats->rxDisabledTime += SYMBOLS_TO_US((uint64_t)(u32MMAC_GetTime() - sRxRing.rxDisabledStart));
+    }
+
+    OSA_InterruptEnable();
+}
+
+void K32WRadioResetRxRingStats(void)
+{
+    OSA_InterruptDisable();
+
+    memset(&sRxRingStats, 0, sizeof(sRxRingStats));
+
+    if (sRxRing.isRxDisabled)
+    {
+        sRxRing.rxDisabledStart = u32MMAC_GetTime();
+    }
+
+    OSA_InterruptEnable();
+}
+
+void K32WRadioSetRxFilter(uint8_t aFilter)
+{
+    sRxFilter = aFilter;
+}
+
+uint8_t K32WRadioGetRxFilter(void)
+{
+    return sRxFilter;
+}
+
+uint8_t K32WRadioGetRoleRxFilter(otDeviceRole aRole, bool aIsScanning)
+{
+    uint8_t filter = 0;
+
+    otEXPECT(!aIsScanning);
+
+    switch (aRole)
+    {
+    case OT_DEVICE_ROLE_CHILD:
+        /* only the routers answer the beacon requests */
+        filter = K32W_RADIO_RX_FILTER_BEACON | K32W_RADIO_RX_FILTER_BEACON_REQUEST;
+        break;
+    case OT_DEVICE_ROLE_ROUTER:
+    case OT_DEVICE_ROLE_LEADER:
+        filter = K32W_RADIO_RX_FILTER_BEACON;
+        break;
+    default:
+        /* a detached device may look for a network */
+        break;
+    }
+
+exit:
+    return filter;
+}
+
+void K32WRadioGetRxFilterStats(K32WRadioRxFilterStats *aStats)
+{
+    OSA_InterruptDisable();
+    *aStats = sRxFilterStats;
+    OSA_InterruptEnable();
+}
+
+void K32WRadioResetRxFilterStats(void)
+{
+    OSA_InterruptDisable();
+    memset(&sRxFilterStats, 0, sizeof(sRxFilterStats));
+    OSA_InterruptEnable();
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return &sTxOtFrame;
+}
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    otError    error    = OT_ERROR_NONE;
+    teTxOption eOptions = E_MMAC_TX_USE_AUTO_ACK;
+    uint32_t   txTime   = 0;
+
+    otEXPECT_ACTION((OT_RADIO_STATE_SLEEP == sState) || (OT_RADIO_STATE_RECEIVE == sState) ||
+                        (OT_RADIO_STATE_RX_DISABLED == sState),
+                    error = OT_ERROR_INVALID_STATE);
+#if K32W0_RADIO_SNIFFER_ENABLE
+    otEXPECT_ACTION(!sIsSnifferEnabled, error = OT_ERROR_INVALID_STATE);
+#endif
+
+    sTxStatus = OT_ERROR_NONE;
+
+    /* prevent multiple calls to the allow to sleep callback */
+    if (TRUE == sAllowDeviceToSleep)
+    {
+        App_DisallowDeviceToSleep();
+        sAllowDeviceToSleep = FALSE;
+        RADIO_LOG("App_DisallowDeviceToSleep");
+    }
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    if (otMacFrameIsSecurityEnabled(aFrame) && otMacFrameIsKeyIdMode1(aFrame) &&
+        !aFrame->mInfo.mTxInfo.mIsSecurityProcessed)
+    {
+        /* Encryption is done by MAC */
+        eOptions |= E_MMAC_TX_ENC;
+
+        if (!aFrame->mInfo.mTxInfo.mIsHeaderUpdated)
+        {
+            /* the header can be updated with frame counter, keyId and CSL IE */
+            eOptions |= E_MMAC_TX_HDR_UPD;
+        }
+    }
+
+    if (aFrame->mInfo.mTxInfo.mTxDelay)
+    {
+        eOptions |= E_MMAC_TX_USE_CCA | E_MMAC_TX_DELAY_START;
+
+        /* txTime is in the future. Convert it to symbol time */
+        txTime        = aFrame->mInfo.mTxInfo.mTxDelay + aFrame->mInfo.mTxInfo.mTxDelayBaseTime;
+        int64_t delta = K32WClockUsDeltaQ4(txTime);
+        txTime        = sClockMap.anchorSym + (int32_t)(delta >> 4);
+    }
+    else
+#endif
+    {
+        eOptions |= E_MMAC_TX_START_NOW;
+    }
+
+    if (aFrame->mInfo.mTxInfo.mCsmaCaEnabled)
+    {
+        eOptions |= E_MMAC_TX_USE_CCA;
     }
 
     /* frame conversion. aOtFrame is sTxOtFrame */
@@ -794,11 +1302,31 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
         sTxMacFrame.u8PayloadLength -= kMicSize;
     }
 
-    /* Set RX buffer pointer for ACK */
-    vMMAC_SetRxFrame((tsRxFrameFormat *)&sRxAckFrame);
+    sTxOptions = eOptions;
+    sTxTime    = txTime;
+#if K32W0_RADIO_HW_RETRANSMIT_ENABLE
+    sTxMaxFrameRetries = MIN(aFrame->mInfo.mTxInfo.mMaxFrameRetries, MAC_TX_RETRIES);
+#else
+    sTxMaxFrameRetries = 0;
+#endif
 
-    /* Status notification is received via K32WISR()  */
-    vMMAC_StartV2MacTransmit(&sTxMacFrame, eOptions, txTime);
+    OSA_InterruptDisable();
+
+    /* go to TX state */
+    K32WSetState(OT_RADIO_STATE_TRANSMIT);
+
+    if (v2MAC_is_rx_ongoing())
+    {
+        /* Don't abort the ongoing Rx. The frame is sent by K32WISR() at the end of it */
+        sTxPending    = TRUE;
+        sPendingStart = u32MMAC_GetTime();
+    }
+    else
+    {
+        K32WStartTransmit();
+    }
+
+    OSA_InterruptEnable();
 
     if (eOptions & E_MMAC_TX_ENC)
     {
@@ -831,41 +1359,50 @@ int8_t otPlatRadioGetRssi(otInstance *aInstance)
     otEXPECT((sState == OT_RADIO_STATE_SLEEP) || (sState == OT_RADIO_STATE_RECEIVE) ||
              (sState == OT_RADIO_STATE_RX_DISABLED));
 
-    /* in RCP designs, the RSSI function is called while the radio is in
-     * OT_RADIO_STATE_RECEIVE. Turn off the radio before reading RSSI,
-     * otherwise we may end up waiting until a packet is received
-     * (in i16MMAC_GetRSSI, while loop)
-     */
-
     OSA_InterruptDisable();
 
-    if ((sState == OT_RADIO_STATE_RECEIVE) || (sState == OT_RADIO_STATE_RX_DISABLED))
+    if (K32WRssiCacheIsValid())
     {
-        /* stop the radio so there are no pending interrupts */
-        vMMAC_RadioToOffAndWait();
-
-        sState       = OT_RADIO_STATE_SLEEP;
-        stateChanged = TRUE;
+        /* recent enough, don't open a window in which frames are dropped */
+        rssidBm = sRssiCache;
     }
+    else
+    {
+        /* in RCP designs, the RSSI function is called while the radio is in
+         * OT_RADIO_STATE_RECEIVE. Turn off the radio before reading RSSI,
+         * otherwise we may end up waiting until a packet is received
+         * (in i16MMAC_GetRSSI, while loop)
+         */
+        if ((sState == OT_RADIO_STATE_RECEIVE) || (sState == OT_RADIO_STATE_RX_DISABLED))
+        {
+            /* stop the radio so there are no pending interrupts */
+            vMMAC_RadioToOffAndWait();
 
-    rssiValSigned = i16MMAC_GetRSSI();
+            K32WSetState(OT_RADIO_STATE_SLEEP);
+            stateChanged = TRUE;
+        }
 
-    if (stateChanged)
-    {
-        sState = OT_RADIO_STATE_RECEIVE;
-        K32WEnableReceive();
-    }
+        rssiValSigned = i16MMAC_GetRSSI();
 
-    OSA_InterruptEnable();
+        if (stateChanged)
+        {
+            K32WSetState(OT_RADIO_STATE_RECEIVE);
+            K32WEnableReceive();
+        }
 
-    otEXPECT((rssiValSigned != MMAC_INVALID_RSSI));
+        if (rssiValSigned != MMAC_INVALID_RSSI)
+        {
+            rssiValSigned = i16Radio_BoundRssiValue(rssiValSigned);
 
-    rssiValSigned = i16Radio_BoundRssiValue(rssiValSigned);
+            /* RSSI reported by radio is in 1/4 dBm step,
+             * meaning values are 4 times larger than real dBm value.
+             */
+            rssidBm = (int8_t)(rssiValSigned >> 2);
+            K32WRssiCacheUpdate(rssidBm);
+        }
+    }
 
-    /* RSSI reported by radio is in 1/4 dBm step,
-     * meaning values are 4 times larger than real dBm value.
-     */
-    rssidBm = (int8_t)(rssiValSigned >> 2);
+    OSA_InterruptEnable();
 
 exit:
     return rssidBm;
@@ -875,11 +1412,15 @@ otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF |
+    return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF | OT_RADIO_CAPS_ENERGY_SCAN |
            OT_RADIO_CAPS_SLEEP_TO_TX
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
            /* MAC doesn't support enc/dec. It uses K32WEncFrame() callback */
            | OT_RADIO_CAPS_TRANSMIT_SEC | OT_RADIO_CAPS_TRANSMIT_TIMING
+#endif
+#if K32W0_RADIO_HW_RETRANSMIT_ENABLE
+           /* the MMAC retransmits the frames which are not acknowledged */
+           | OT_RADIO_CAPS_TRANSMIT_RETRIES
 #endif
         ;
 }
@@ -914,8 +1455,43 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError status = OT_ERROR_NOT_IMPLEMENTED;
+    otError status = OT_ERROR_NONE;
+
+    otEXPECT_ACTION((sState == OT_RADIO_STATE_SLEEP) || (sState == OT_RADIO_STATE_RECEIVE) ||
+                        (sState == OT_RADIO_STATE_RX_DISABLED),
+                    status = OT_ERROR_INVALID_STATE);
+
+    /* prevent multiple calls to the allow to sleep callback */
+    if (TRUE == sAllowDeviceToSleep)
+    {
+        App_DisallowDeviceToSleep();
+        sAllowDeviceToSleep = FALSE;
+        RADIO_LOG("App_DisallowDeviceToSleep");
+    }
+
+    OSA_InterruptDisable();
+
+    /* stop the radio so there are no pending interrupts */
+    vMMAC_RadioToOffAndWait();
+    K32WApplyPendingChannel();
+
+    sEdScanPrevState   = (sState == OT_RADIO_STATE_SLEEP) ? OT_RADIO_STATE_SLEEP : OT_RADIO_STATE_RECEIVE;
+    sEdScanPrevChannel = sChannel;
+    K32WSetState(OT_RADIO_STATE_ED_SCAN);
 
+    OSA_InterruptEnable();
+
+    sChannel = aScanChannel;
+    K32WModemSetChannelAndPower(sChannel, sTxPwrLevel);
+
+    /* RSSI is sampled by K32WProcessEnergyScan(), woken by the wake timer, until the scan duration expires */
+    sEdScanMaxRssi   = MMAC_INVALID_RSSI;
+    sEdScanEnd       = otPlatTimeGet() + (uint64_t)aScanDuration * US_TO_MILI_DIVIDER;
+    sEdScanSampleDue = TRUE;
+
+    otSysEventSignalPending();
+
+exit:
     return status;
 }
 
@@ -959,17 +1535,17 @@ otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
      * the radio off command called inside set channel and power */
     if (0 != sChannel)
     {
-        vMMAC_SetChannelAndPower(sChannel, aPower);
+        K32WModemSetChannelAndPower(sChannel, aPower);
     }
     else
     {
         /* if the channel has not yet been initialized use K32W_RADIO_DEFAULT_CHANNEL as default */
-        vMMAC_SetChannelAndPower(K32W_RADIO_DEFAULT_CHANNEL, aPower);
+        K32WModemSetChannelAndPower(K32W_RADIO_DEFAULT_CHANNEL, aPower);
     }
 
     if ((sState == OT_RADIO_STATE_RECEIVE) || (sState == OT_RADIO_STATE_RX_DISABLED))
     {
-        sState = OT_RADIO_STATE_RECEIVE;
+        K32WSetState(OT_RADIO_STATE_RECEIVE);
         K32WEnableReceive();
     }
 
@@ -993,6 +1569,28 @@ otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aTh
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+#if K32W0_RADIO_STATS_ENABLE
+void K32WRadioGetStats(K32WRadioStats *aStats)
+{
+    OSA_InterruptDisable();
+
+    K32WStatsAccountState();
+    *aStats = sRadioStats;
+
+    OSA_InterruptEnable();
+}
+
+void K32WRadioResetStats(void)
+{
+    OSA_InterruptDisable();
+
+    memset(&sRadioStats, 0, sizeof(sRadioStats));
+    sStatsStateStart = otPlatTimeGet();
+
+    OSA_InterruptEnable();
+}
+#endif
+
 int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -1000,94 +1598,132 @@ int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
     return K32W_RADIO_RX_SENSITIVITY_DBM;
 }
 
-/**
- * Interrupt service routine (e.g.: TX/RX/MAC HDR received)
- *
- * @param[in] u32IntBitmap  Bitmap telling which interrupt fired
- *
- */
-static void K32WISR(uint32_t u32IntBitmap)
+#if K32W0_RADIO_SNIFFER_ENABLE
+otError K32WRadioSnifferStart(uint8_t aChannel)
 {
-    rxRingBufferEntry *rbe = NULL;
+    otError     error = OT_ERROR_NONE;
+    pcapFileHdr hdr   = {
+        .magic        = PCAP_MAGIC,
+        .versionMajor = 2,
+        .versionMinor = 4,
+        .snapLen      = PCAP_SNAPLEN,
+        .linkType     = PCAP_LINKTYPE_IEEE802_15_4_TAP,
+    };
 
-    switch (sState)
+    otEXPECT_ACTION((sState == OT_RADIO_STATE_SLEEP) || (sState == OT_RADIO_STATE_RECEIVE) ||
+                        (sState == OT_RADIO_STATE_RX_DISABLED),
+                    error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION((aChannel >= 11) && (aChannel <= 26), error = OT_ERROR_INVALID_ARGS);
+
+    /* prevent multiple calls to the allow to sleep callback */
+    if (TRUE == sAllowDeviceToSleep)
     {
-    case OT_RADIO_STATE_RECEIVE:
+        App_DisallowDeviceToSleep();
+        sAllowDeviceToSleep = FALSE;
+        RADIO_LOG("App_DisallowDeviceToSleep");
+    }
 
-        if (u32IntBitmap & E_MMAC_INT_RX_HEADER)
-        {
-            /* This event doesn't mean end of reception */
+    /* every capture starts with the pcap file header */
+    K32WSnifferOutput((const uint8_t *)&hdr, sizeof(hdr));
 
-            /* go back one index from current frame index */
-            rbe = &sRxRing.buffer[sRxRing.next];
+    OSA_InterruptDisable();
 
-            /* FP processing first */
-            K32WProcessMacHeader(&rbe->f);
-        }
+    vMMAC_RadioToOffAndWait();
 
-        if (u32IntBitmap & E_MMAC_INT_RX_COMPLETE)
-        {
-            /* no rx errors */
-            if (0 == u32V2MAC_GetRxErrors())
-            {
-                /* go back one index from current frame index */
-                rbe = &sRxRing.buffer[sRxRing.next];
+    memset(&sSnifferStats, 0, sizeof(sSnifferStats));
+    sSnifferRing.head = 0;
+    sSnifferRing.tail = 0;
+    sIsSnifferEnabled = TRUE;
+    sRxPendingChannel = 0;
+    sChannel          = aChannel;
+    K32WModemSetChannelAndPower(sChannel, sTxPwrLevel);
 
-                /* Get rx info for frame */
-                K32WGetRxFrameInfo(rbe);
+    K32WSetState(OT_RADIO_STATE_RECEIVE);
+    K32WEnableReceive();
 
-                /* RX interrupt fired so it's safe to consume the frame */
-                K32WPushRxRingBuffer();
-            }
+    OSA_InterruptEnable();
 
-            /* restart RX */
+exit:
+    return error;
+}
+
+void K32WRadioSnifferStop(void)
+{
+    OSA_InterruptDisable();
+
+    if (sIsSnifferEnabled)
+    {
+        vMMAC_RadioToOffAndWait();
+        sIsSnifferEnabled = FALSE;
+
+        if (sState == OT_RADIO_STATE_RECEIVE)
+        {
             K32WEnableReceive();
         }
+    }
 
-        BOARD_LedDongleToggle();
-        break;
-    case OT_RADIO_STATE_TRANSMIT:
+    OSA_InterruptEnable();
 
-        if (u32IntBitmap & E_MMAC_INT_TX_COMPLETE)
-        {
-            uint32_t txErrors = u32V2MAC_GetTxErrors();
+    /* stream what was captured before the stop */
+    K32WProcessSnifferFrames();
+}
 
-            if (txErrors & E_MMAC_TXSTAT_CCA_BUSY)
-            {
-                sTxStatus = OT_ERROR_CHANNEL_ACCESS_FAILURE;
-            }
-            else if (txErrors & E_MMAC_TXSTAT_NO_ACK)
-            {
-                sTxStatus = OT_ERROR_NO_ACK;
-            }
-            else if (txErrors & E_MMAC_TXSTAT_ABORTED)
-            {
-                sTxStatus = OT_ERROR_ABORT;
-            }
-            else if ((txErrors & E_MMAC_TXSTAT_TXPCTO) || (txErrors & E_MMAC_TXSTAT_TXTO))
-            {
-                /* The JN518x/K32W0x1 has a TXTO timeout.
-                   Describe failure as a CCA failure for onward processing */
-                sTxStatus = OT_ERROR_CHANNEL_ACCESS_FAILURE;
-            }
-            else
-            {
-                /* No error, convert ACK */
-                K32WFrameConversion(&sRxAckFrame, &sAckOtFrame);
-                sAckOtFrame.mChannel = sTxOtFrame.mChannel; /* ACK channel */
-            }
+void K32WRadioGetSnifferStats(K32WRadioSnifferStats *aStats)
+{
+    OSA_InterruptDisable();
+    *aStats = sSnifferStats;
+    OSA_InterruptEnable();
+}
+
+/* Stub function for the capture output, sent over the log UART by default */
+WEAK void K32WSnifferOutput(const uint8_t *aBuf, uint32_t aLen)
+{
+    K32WWriteBlocking(aBuf, aLen);
+}
+#endif
+
+/**
+ * Interrupt service routine (e.g.: TX/RX/MAC HDR received)
+ *
+ * @param[in] u32IntBitmap  Bitmap telling which interrupt fired
+ *
+ */
+static void K32WISR(uint32_t u32IntBitmap)
+{
+#if K32W0_RADIO_STATS_ENABLE
+    uint32_t start = K32W_CYCLES_NOW();
+#endif
+
+    switch (sState)
+    {
+    case OT_RADIO_STATE_RECEIVE:
+
+        if (K32WRxIsr(u32IntBitmap))
+        {
+            /* restart RX */
+            K32WEnableReceive();
+        }
 
-            /* Tx finished */
-            sTxDone = TRUE;
+        BOARD_LedDongleToggle();
+        break;
+    case OT_RADIO_STATE_TRANSMIT:
 
-            /* go to RX and restore channel */
-            if (sChannel != sTxOtFrame.mChannel)
+        if (sTxPending)
+        {
+            /* TX was requested during an Rx, start it now that the Rx is over */
+            if (K32WRxIsr(u32IntBitmap))
             {
-                vMMAC_SetChannelAndPower(sChannel, sTxPwrLevel);
+                sTxPending = FALSE;
+                K32WStartTransmit();
             }
+        }
+        else if (u32IntBitmap & E_MMAC_INT_TX_COMPLETE)
+        {
+            K32WTxCompleteIsr();
 
+            /* go to RX */
             BOARD_LedDongleToggle();
-            sState = OT_RADIO_STATE_RECEIVE;
+            K32WSetState(OT_RADIO_STATE_RECEIVE);
             K32WEnableReceive();
         }
         break;
@@ -1096,8 +1732,317 @@ static void K32WISR(uint32_t u32IntBitmap)
         break;
     }
 
+    if (sIsRxDropped)
+    {
+        /* nothing to process */
+        sIsRxDropped = FALSE;
+    }
+    else
+    {
+        otSysEventSignalPending();
+    }
+
+#if K32W0_RADIO_STATS_ENABLE
+    K32WStatsAddCycles(sRadioStats.isrHist, &sRadioStats.isrMaxCycles, K32W_CYCLES_NOW() - start);
+#endif
+}
+
+/**
+ * Handle the RX related interrupts (MAC HDR received / RX complete)
+ *
+ * @param[in] u32IntBitmap  Bitmap telling which interrupt fired
+ *
+ * @return    TRUE          The reception is over and the radio is idle
+ * @return    FALSE         The reception is still ongoing
+ *
+ */
+static bool_t K32WRxIsr(uint32_t u32IntBitmap)
+{
+    rxRingBufferEntry *rbe = NULL;
+
+#if K32W0_RADIO_SNIFFER_ENABLE
+    if (sIsSnifferEnabled)
+    {
+        return K32WSnifferRxIsr(u32IntBitmap);
+    }
+#endif
+
+    if (u32IntBitmap & E_MMAC_INT_RX_HEADER)
+    {
+        /* This event doesn't mean end of reception */
+
+        /* go back one index from current frame index */
+        rbe = &sRxRing.buffer[sRxRing.next];
+
+        /* FP processing first */
+#if K32W0_RADIO_STATS_ENABLE
+        uint32_t start = K32W_CYCLES_NOW();
+        K32WProcessMacHeader(&rbe->f);
+        K32WStatsAddCycles(sRadioStats.macHdrHist, &sRadioStats.macHdrMaxCycles, K32W_CYCLES_NOW() - start);
+#else
+        K32WProcessMacHeader(&rbe->f);
+#endif
+    }
+
+    if (u32IntBitmap & E_MMAC_INT_RX_COMPLETE)
+    {
+        /* no rx errors */
+        if (0 == u32V2MAC_GetRxErrors())
+        {
+            /* go back one index from current frame index */
+            rbe = &sRxRing.buffer[sRxRing.next];
+
+            if (sRxFilter && !sPromiscuousEnable && K32WRxFilterDrop(&rbe->f))
+            {
+                /* the ring entry is reused by the next reception */
+                sIsRxDropped = TRUE;
+                return TRUE;
+            }
+
+            /* Get rx info for frame */
+            K32WGetRxFrameInfo(rbe);
+
+            /* RX interrupt fired so it's safe to consume the frame */
+            K32WPushRxRingBuffer();
+            K32W_RADIO_STATS_INC(rxAccepted);
+        }
+        else
+        {
+            K32W_RADIO_STATS_INC(rxRejected);
+        }
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * Start the transmission of sTxMacFrame. Called from process context or from
+ * K32WISR() when the TX was deferred until the end of an ongoing reception.
+ * Interrupts must be disabled when called from process context.
+ */
+static void K32WStartTransmit(void)
+{
+    /* stop the radio so there are no pending interrupts */
+    vMMAC_RadioToOffAndWait();
+    K32WApplyPendingChannel();
+
+    /* set tx channel */
+    if (sChannel != sTxOtFrame.mChannel)
+    {
+        /* after tx ends, rx on the same channel */
+        sChannel = sTxOtFrame.mChannel;
+
+        K32WModemSetChannelAndPower(sTxOtFrame.mChannel, sTxPwrLevel);
+    }
+
+    if ((sTxOptions & E_MMAC_TX_DELAY_START) == E_MMAC_TX_DELAY_START)
+    {
+        /* No retransmissions, just 1 CCA */
+        vMMAC_SetTxParameters(1, 0, 0, 0);
+    }
+    else if (sTxOptions & E_MMAC_TX_USE_CCA)
+    {
+        /* each attempt starts with a CSMA-CA */
+        vMMAC_SetTxParameters(1 + sTxMaxFrameRetries, MAC_TX_CSMA_MIN_BE, MAC_TX_CSMA_MAX_BE,
+                              sTxOtFrame.mInfo.mTxInfo.mMaxCsmaBackoffs);
+    }
+    else
+    {
+        vMMAC_SetTxParameters(1 + sTxMaxFrameRetries, 0, 0, 0);
+    }
+
+    /* Set RX buffer pointer for ACK */
+    vMMAC_SetRxFrame((tsRxFrameFormat *)&sRxAckFrame);
+
+    /* Status notification is received via K32WISR()  */
+    vMMAC_StartV2MacTransmit(&sTxMacFrame, sTxOptions, sTxTime);
+    K32W_RADIO_STATS_INC(txAttempts);
+}
+
+/**
+ * Handle the TX complete interrupt: get the TX status and the ACK.
+ */
+static void K32WTxCompleteIsr(void)
+{
+    uint32_t txErrors = u32V2MAC_GetTxErrors();
+
+#if K32W0_RADIO_STATS_ENABLE
+    static const uint32_t kTxErrorBits[K32W_RADIO_STATS_NUM_OF_TX_ERRORS] = {
+        E_MMAC_TXSTAT_CCA_BUSY, E_MMAC_TXSTAT_NO_ACK, E_MMAC_TXSTAT_ABORTED, E_MMAC_TXSTAT_TXPCTO, E_MMAC_TXSTAT_TXTO};
+
+    for (uint8_t i = 0; i < K32W_RADIO_STATS_NUM_OF_TX_ERRORS; i++)
+    {
+        sRadioStats.txErrors[i] += ((txErrors & kTxErrorBits[i]) != 0);
+    }
+
+    sRadioStats.txSuccess += (txErrors == 0);
+#endif
+
+    if (txErrors & E_MMAC_TXSTAT_CCA_BUSY)
+    {
+        sTxStatus = OT_ERROR_CHANNEL_ACCESS_FAILURE;
+    }
+    else if (txErrors & E_MMAC_TXSTAT_NO_ACK)
+    {
+        sTxStatus = OT_ERROR_NO_ACK;
+    }
+    else if (txErrors & E_MMAC_TXSTAT_ABORTED)
+    {
+        sTxStatus = OT_ERROR_ABORT;
+    }
+    else if ((txErrors & E_MMAC_TXSTAT_TXPCTO) || (txErrors & E_MMAC_TXSTAT_TXTO))
+    {
+        /* The JN518x/K32W0x1 has a TXTO timeout.
+           Describe failure as a CCA failure for onward processing */
+        sTxStatus = OT_ERROR_CHANNEL_ACCESS_FAILURE;
+    }
+    else
+    {
+        /* No error, keep what the next reception overwrites. The ACK is converted by K32WProcessTxFrame() */
+        sAckTimestamp = u32V2MAC_GetRxTimestamp();
+        sAckLqi       = u8MMAC_GetRxLqi(NULL);
+        sAckRssi      = i8Radio_GetLastPacketRSSI();
+    }
+
+    /* Tx finished */
+    sTxDone = TRUE;
+}
+
+/**
+ * Switch to the RX channel requested during an ongoing reception, if any.
+ * Should be called when radio is idle.
+ */
+static void K32WApplyPendingChannel(void)
+{
+    if (sRxPendingChannel)
+    {
+        sChannel          = sRxPendingChannel;
+        sRxPendingChannel = 0;
+        K32WModemSetChannelAndPower(sChannel, sTxPwrLevel);
+    }
+}
+
+/**
+ * Start the requests deferred because of an ongoing reception if the RX
+ * complete interrupt didn't come in time (TX_TO).
+ */
+static void K32WProcessPendingRequests(void)
+{
+    otEXPECT(sTxPending || sRxPendingChannel);
+
+    OSA_InterruptDisable();
+
+    if ((sTxPending || sRxPendingChannel) && ((u32MMAC_GetTime() - sPendingStart) >= TX_TO))
+    {
+        if (sTxPending)
+        {
+            sTxPending = FALSE;
+            K32WStartTransmit();
+        }
+        else if (sState == OT_RADIO_STATE_RECEIVE)
+        {
+            vMMAC_RadioToOffAndWait();
+            K32WEnableReceive();
+        }
+    }
+
+    OSA_InterruptEnable();
+
+exit:
+    return;
+}
+
+/**
+ * Energy scan processing: sample the RSSI each time the energy scan timer fires
+ * and report the highest value when the scan duration expires. The device can
+ * sleep (WFI) between two samples.
+ *
+ * @param[in] aInstance  Pointer to OT instance
+ */
+static void K32WProcessEnergyScan(otInstance *aInstance)
+{
+    int16_t rssi;
+    int8_t  maxRssidBm = OT_RADIO_RSSI_INVALID;
+
+    otEXPECT((sState == OT_RADIO_STATE_ED_SCAN) && sEdScanSampleDue);
+    sEdScanSampleDue = FALSE;
+
+    /* the radio is off, so the RSSI is measured right away */
+    rssi = i16MMAC_GetRSSI();
+
+    if ((rssi != MMAC_INVALID_RSSI) && ((sEdScanMaxRssi == MMAC_INVALID_RSSI) || (rssi > sEdScanMaxRssi)))
+    {
+        sEdScanMaxRssi = rssi;
+    }
+
+    /* wait for the next sample until the scan is over */
+    otEXPECT_ACTION(otPlatTimeGet() >= sEdScanEnd, K32WEdScanScheduleSample());
+
+    /* restore the radio as it was before the scan */
+    sChannel = sEdScanPrevChannel;
+    K32WModemSetChannelAndPower(sChannel, sTxPwrLevel);
+
+    if (sEdScanPrevState == OT_RADIO_STATE_RECEIVE)
+    {
+        K32WSetState(OT_RADIO_STATE_RECEIVE);
+        K32WEnableReceive();
+    }
+    else
+    {
+        K32WSetState(OT_RADIO_STATE_SLEEP);
+
+        App_AllowDeviceToSleep();
+        sAllowDeviceToSleep = TRUE;
+        RADIO_LOG("App_AllowDeviceToSleep");
+    }
+
+    if (sEdScanMaxRssi != MMAC_INVALID_RSSI)
+    {
+        /* RSSI reported by radio is in 1/4 dBm step */
+        maxRssidBm = (int8_t)(i16Radio_BoundRssiValue(sEdScanMaxRssi) >> 2);
+    }
+
+    otPlatRadioEnergyScanDone(aInstance, maxRssidBm);
+
+exit:
+    return;
+}
+
+/**
+ * Arm the energy scan timer for the next RSSI sample, or for the end of the scan if it comes first.
+ */
+static void K32WEdScanScheduleSample(void)
+{
+    uint64_t now   = otPlatTimeGet();
+    uint64_t delay = sEdScanEnd - now;
+    uint32_t ticks;
+
+    if (delay > K32W0_RADIO_ED_SCAN_SAMPLE_PERIOD_US)
+    {
+        delay = K32W0_RADIO_ED_SCAN_SAMPLE_PERIOD_US;
+    }
+
+    ticks = (uint32_t)TMR_ConvertUsToTicks(delay);
+
+    if (ticks == 0)
+    {
+        K32WEdScanTimerCallback();
+    }
+    else
+    {
+        TMR_eRemoveActivity(&sEdScanTimer);
+        TMR_eScheduleActivity32kTicks(&sEdScanTimer, ticks, K32WEdScanTimerCallback);
+    }
+}
+
+static void K32WEdScanTimerCallback(void)
+{
+    sEdScanSampleDue = TRUE;
     otSysEventSignalPending();
 }
+
 /**
  * Process the MAC Header of the latest received packet
  * We are in interrupt context - we need to compute the FP
@@ -1115,9 +2060,26 @@ static void K32WProcessMacHeader(tsPhyFrame *aRxFrame)
     if (!aRxFrame)
         return;
 
+#if K32W0_RADIO_STATS_ENABLE
+    uint32_t start        = K32W_CYCLES_NOW();
+    bool     isFpRequired = K32WCheckIfFpRequired(aRxFrame);
+    uint32_t cycles       = K32W_CYCLES_NOW() - start;
+
+    vMMAC_SetTxPend(isFpRequired);
+
+    sFpStats.lookups++;
+    sFpStats.hits += isFpRequired;
+    sFpStats.totalCycles += cycles;
+
+    if (cycles > sFpStats.maxCycles)
+    {
+        sFpStats.maxCycles = cycles;
+    }
+#else
     bool isFpRequired = K32WCheckIfFpRequired(aRxFrame);
 
     vMMAC_SetTxPend(isFpRequired);
+#endif
 
     /* use the unused filed to store if the frame was ack'ed with FP and report this back to OT stack */
     aRxFrame->au8Padding[0] = isFpRequired;
@@ -1129,218 +2091,891 @@ static void K32WProcessMacHeader(tsPhyFrame *aRxFrame)
  *
  * @param[in] aRxFrame  Pointer to a Data Request Frame
  *
- * @return    TRUE 	    Frame Pending bit should be set in the reply
- * @return    FALSE	    Frame Pending bit shouldn't be set in the reply
+ * @return    TRUE 	    Frame Pending bit should be set in the reply
+ * @return    FALSE	    Frame Pending bit shouldn't be set in the reply
+ *
+ */
+static bool K32WCheckIfFpRequired(tsPhyFrame *aRxFrame)
+{
+    bool          isFpRequired = FALSE;
+    uint8_t       idx          = 0;
+    uint16_t      panId        = sPanId;
+    uint8_t       addrType     = OT_MAC_ADDRESS_TYPE_NONE;
+    uint64_t      addr         = 0;
+    uint16_t      fcf;
+    uint8_t       offset;
+    fpPanTables * pan;
+    fpCacheEntry *entry;
+    otRadioFrame  f;
+    otMacAddress  srcAddr;
+
+    f.mPsdu   = aRxFrame->uPayload.au8Byte;
+    f.mLength = aRxFrame->u8PayloadLength;
+
+    if (!(
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+            /* Enhanced frame pending */
+            (otMacFrameIsVersion2015(&f) && otMacFrameIsCommand(&f)) || otMacFrameIsData(&f) ||
+#endif
+            otMacFrameIsDataRequest(&f)))
+    {
+        return FALSE;
+    }
+
+    if (!sIsFpEnabled)
+    {
+        return TRUE;
+    }
+
+    otEXPECT(f.mLength >= kFcfSize);
+    fcf    = f.mPsdu[0] | (f.mPsdu[1] << 8);
+    offset = kFcfSize + ((fcf & kFcfSeqNbSuppresssion) ? 0 : kDsnSize);
+
+    if ((fcf & kFcfFrameVersionMask) != kFcfFrameVersion2015)
+    {
+        /* 2003/2006 frames (data polls): the source address follows the destination one */
+        uint8_t srcOffset = offset;
+
+        srcOffset += ((fcf & kFcfDstAddrMask) != kFcfDstAddrNone) ? kPanIdSize : 0;
+        srcOffset += ((fcf & kFcfDstAddrMask) == kFcfDstAddrShort) ? kShortAddrSize : 0;
+        srcOffset += ((fcf & kFcfDstAddrMask) == kFcfDstAddrExt) ? kExtAddrSize : 0;
+        srcOffset += (fcf & kFcfPanidCompression) ? 0 : kPanIdSize;
+
+        switch (fcf & kFcfSrcAddrMask)
+        {
+        case kFcfSrcAddrShort:
+            otEXPECT(f.mLength >= srcOffset + kShortAddrSize);
+            addrType = OT_MAC_ADDRESS_TYPE_SHORT;
+            addr     = f.mPsdu[srcOffset] | (f.mPsdu[srcOffset + 1] << 8);
+            break;
+        case kFcfSrcAddrExt:
+            otEXPECT(f.mLength >= srcOffset + kExtAddrSize);
+            addrType = OT_MAC_ADDRESS_TYPE_EXTENDED;
+            addr     = otEncodingReadUint64Le(&f.mPsdu[srcOffset]);
+            break;
+        default:
+            addrType = OT_MAC_ADDRESS_TYPE_NONE;
+            break;
+        }
+    }
+    else
+    {
+        otEXPECT(otMacFrameGetSrcAddr(&f, &srcAddr) == OT_ERROR_NONE);
+
+        addrType = srcAddr.mType;
+
+        if (srcAddr.mType == OT_MAC_ADDRESS_TYPE_SHORT)
+        {
+            addr = srcAddr.mAddress.mShortAddress;
+        }
+        else if (srcAddr.mType == OT_MAC_ADDRESS_TYPE_EXTENDED)
+        {
+            /* srcAddr.mAddress.mExtAddress is returned in reverse order (big endian) */
+            addr = __builtin_bswap64(otEncodingReadUint64Le(srcAddr.mAddress.mExtAddress.m8));
+        }
+    }
+
+    if (addrType == OT_MAC_ADDRESS_TYPE_NONE)
+    {
+        return TRUE;
+    }
+
+    /* The destination PAN selects the tables, frames without it are for the Thread PAN */
+    if (K32WIsDstPanIdPresent(fcf))
+    {
+        otEXPECT(f.mLength >= offset + kPanIdSize);
+        panId = f.mPsdu[offset] | (f.mPsdu[offset + 1] << 8);
+    }
+
+    /* repeated polls from a child are answered from the cache until the tables change */
+    entry = &sFpCache[(uint32_t)(addr ^ (addr >> 32) ^ panId) & (K32W0_RADIO_FP_CACHE_SIZE - 1)];
+
+    if ((entry->generation == sFpGeneration) && (entry->addr == addr) && (entry->panId == panId) &&
+        (entry->addrType == addrType))
+    {
+#if K32W0_RADIO_STATS_ENABLE
+        sFpStats.cacheHits++;
+#endif
+        return entry->isFpRequired;
+    }
+
+    pan = K32WFpGetPanTables(panId, false);
+
+    if (pan == NULL)
+    {
+        isFpRequired = FALSE;
+    }
+    else if (addrType == OT_MAC_ADDRESS_TYPE_SHORT)
+    {
+        idx          = K32WFpShortAddrLowerBound(&pan->shortAddr, (uint16_t)addr);
+        isFpRequired = (idx < pan->shortAddr.num) && (pan->shortAddr.addr[idx] == addr);
+    }
+    else
+    {
+        idx          = K32WFpExtAddrLowerBound(&pan->extAddr, addr);
+        isFpRequired = (idx < pan->extAddr.num) && (pan->extAddr.addr[idx] == addr);
+    }
+
+    entry->addr         = addr;
+    entry->panId        = panId;
+    entry->addrType     = addrType;
+    entry->isFpRequired = isFpRequired;
+    entry->generation   = sFpGeneration;
+
+exit:
+    return isFpRequired;
+}
+
+/**
+ * Check if the destination PAN ID is present in a MAC header
+ * (IEEE Std 802.15.4-2015, Table 7-2 for 2015 frames).
+ *
+ * @param[in] aFcf  Frame Control Field
+ *
+ * @return    TRUE if the destination PAN ID follows the sequence number
+ *
+ */
+static bool K32WIsDstPanIdPresent(uint16_t aFcf)
+{
+    bool isPresent = ((aFcf & kFcfDstAddrMask) != kFcfDstAddrNone);
+
+    if ((aFcf & kFcfFrameVersionMask) == kFcfFrameVersion2015)
+    {
+        switch (aFcf & (kFcfDstAddrMask | kFcfSrcAddrMask | kFcfPanidCompression))
+        {
+        case (kFcfDstAddrNone | kFcfSrcAddrNone):
+        case (kFcfDstAddrExt | kFcfSrcAddrNone | kFcfPanidCompression):
+        case (kFcfDstAddrShort | kFcfSrcAddrNone | kFcfPanidCompression):
+        case (kFcfDstAddrNone | kFcfSrcAddrExt):
+        case (kFcfDstAddrNone | kFcfSrcAddrShort):
+        case (kFcfDstAddrNone | kFcfSrcAddrExt | kFcfPanidCompression):
+        case (kFcfDstAddrNone | kFcfSrcAddrShort | kFcfPanidCompression):
+        case (kFcfDstAddrExt | kFcfSrcAddrExt | kFcfPanidCompression):
+            isPresent = FALSE;
+            break;
+        default:
+            isPresent = TRUE;
+            break;
+        }
+    }
+
+    return isPresent;
+}
+
+/**
+ * Get the source match tables of a PAN
+ *
+ * @param[in] aPanId    PAN ID
+ * @param[in] aCreate   TRUE to assign unused (or empty) tables to aPanId if it has none
+ *
+ * @return    Pointer to the tables of aPanId, NULL if none
+ *
+ */
+static fpPanTables *K32WFpGetPanTables(uint16_t aPanId, bool aCreate)
+{
+    fpPanTables *pan = NULL;
+
+    for (uint8_t i = 0; i < K32W0_RADIO_NUM_OF_FP_PANS; i++)
+    {
+        if (sFpPans[i].inUse && (sFpPans[i].panId == aPanId))
+        {
+            return &sFpPans[i];
+        }
+
+        if ((pan == NULL) && aCreate && (sFpPans[i].shortAddr.num == 0) && (sFpPans[i].extAddr.num == 0))
+        {
+            /* tables left empty by a previous PAN can be reused */
+            pan = &sFpPans[i];
+        }
+    }
+
+    if (pan != NULL)
+    {
+        pan->panId = aPanId;
+        pan->inUse = true;
+    }
+
+    return pan;
+}
+
+/**
+ * Binary search inside the short addresses source match table
+ *
+ * @param[in] aShortAddress  Short address to look for
+ *
+ * @return    Index of the first entry which is not less than aShortAddress
+ *
+ */
+static uint8_t K32WFpShortAddrLowerBound(const fpShortAddrTable *aTable, uint16_t aShortAddress)
+{
+    uint8_t lo = 0;
+    uint8_t hi = aTable->num;
+
+    while (lo < hi)
+    {
+        uint8_t mid = (lo + hi) >> 1;
+
+        if (aTable->addr[mid] < aShortAddress)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * Binary search inside the extended addresses source match table
+ *
+ * @param[in] aExtAddress  Extended address (native byte order) to look for
+ *
+ * @return    Index of the first entry which is not less than aExtAddress
+ *
+ */
+static uint8_t K32WFpExtAddrLowerBound(const fpExtAddrTable *aTable, uint64_t aExtAddress)
+{
+    uint8_t lo = 0;
+    uint8_t hi = aTable->num;
+
+    while (lo < hi)
+    {
+        uint8_t mid = (lo + hi) >> 1;
+
+        if (aTable->addr[mid] < aExtAddress)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * Remove an entry from the short addresses source match table, keeping it sorted
+ *
+ * @param[in] aIdx  Index of the entry to be removed
+ *
+ */
+static void K32WFpShortAddrRemove(fpShortAddrTable *aTable, uint8_t aIdx)
+{
+    OSA_InterruptDisable();
+
+    aTable->num--;
+    memmove(&aTable->addr[aIdx], &aTable->addr[aIdx + 1], (aTable->num - aIdx) * sizeof(aTable->addr[0]));
+    sFpGeneration++;
+
+    OSA_InterruptEnable();
+}
+
+/**
+ * Remove an entry from the extended addresses source match table, keeping it sorted
+ *
+ * @param[in] aIdx  Index of the entry to be removed
+ *
+ */
+static void K32WFpExtAddrRemove(fpExtAddrTable *aTable, uint8_t aIdx)
+{
+    OSA_InterruptDisable();
+
+    aTable->num--;
+    memmove(&aTable->addr[aIdx], &aTable->addr[aIdx + 1], (aTable->num - aIdx) * sizeof(aTable->addr[0]));
+    sFpGeneration++;
+
+    OSA_InterruptEnable();
+}
+
+/**
+ * Process RX frames in process context and call the upper layer call-backs
+ *
+ * @param[in] aInstance  Pointer to OT instance
+ */
+static void K32WProcessRxFrames(otInstance *aInstance)
+{
+    rxRingBufferEntry *rbe = NULL;
+
+    while ((rbe = K32WGetRxRingBuffer()) != NULL)
+    {
+        otPlatRadioReceiveDone(aInstance, &rbe->of, OT_ERROR_NONE);
+
+        K32WPopRxRingBuffer();
+
+        if (sState == OT_RADIO_STATE_RX_DISABLED)
+        {
+            K32WSetState(OT_RADIO_STATE_RECEIVE);
+            K32WEnableReceive();
+        }
+    }
+
+    if (sState == OT_RADIO_STATE_RX_DISABLED)
+    {
+        K32WSetState(OT_RADIO_STATE_RECEIVE);
+        K32WEnableReceive();
+    }
+}
+
+/**
+ * Process TX frame in process context and call the upper layer call-backs
+ *
+ * @param[in] aInstance  Pointer to OT instance
+ */
+static void K32WProcessTxFrame(otInstance *aInstance)
+{
+    if (sTxDone)
+    {
+        sTxDone = FALSE;
+        if ((sTxOtFrame.mPsdu[kMacFcfLowOffset] & kFcfAckRequest) && (OT_ERROR_NONE == sTxStatus))
+        {
+            sAckOtFrame.mLength                  = sRxAckFrame.u8PayloadLength;
+            sAckOtFrame.mChannel                 = sTxOtFrame.mChannel; /* ACK channel */
+            sAckOtFrame.mInfo.mRxInfo.mTimestamp = K32WClockSymbolsToUs(sAckTimestamp);
+            sAckOtFrame.mInfo.mRxInfo.mLqi       = sAckLqi;
+            sAckOtFrame.mInfo.mRxInfo.mRssi      = sAckRssi;
+
+            otPlatRadioTxDone(aInstance, &sTxOtFrame, &sAckOtFrame, sTxStatus);
+        }
+        else
+        {
+            otPlatRadioTxDone(aInstance, &sTxOtFrame, NULL, sTxStatus);
+        }
+    }
+}
+
+static void K32WGetRxFrameInfo(rxRingBufferEntry *rbe)
+{
+    memset(&rbe->of.mInfo.mRxInfo, 0, sizeof(rbe->of.mInfo.mRxInfo));
+
+    /* must be called after Rx complete to get correct values from MAC */
+    K32WFrameConversion(&rbe->f, &rbe->of);
+
+    rbe->of.mChannel                             = sChannel; /* Rx channel */
+    rbe->of.mInfo.mRxInfo.mAckedWithFramePending = (bool)rbe->f.au8Padding[0];
+
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
+    if (sCslPeriod)
+    {
+        uint8_t keyId;
+
+        if (otMacFrameIsVersion2015(&rbe->of) && otMacFrameIsAckRequested(&rbe->of) &&
+            otMacFrameIsSecurityEnabled(&rbe->of) && otMacFrameIsKeyIdMode1(&rbe->of) &&
+            ((keyId = otMacFrameGetKeyId(&rbe->of)) != 0) &&
+            ((keyId == sKeyId) || (keyId == sKeyId - 1) || (keyId == sKeyId + 1)))
+        {
+            rbe->of.mInfo.mRxInfo.mAckedWithSecEnhAck = true;
+            rbe->of.mInfo.mRxInfo.mAckKeyId           = keyId;
+            rbe->of.mInfo.mRxInfo.mAckFrameCounter    = sMacFrameCounter;
+            sMacFrameCounter++;
+        }
+    }
+#endif
+}
+
+/**
+ * aMacFormatFrame <-> aOtFrame bidirectional conversion
+ *
+ * @param[in] data             Pointer to frame or ring buffer entry
+ * @param[in] aOtFrame         Pointer to OpenThread Frame
+ */
+static void K32WFrameConversion(tsPhyFrame *aPhyFrame, otRadioFrame *aOtFrame)
+{
+    aOtFrame->mLength                  = aPhyFrame->u8PayloadLength;
+    aOtFrame->mInfo.mRxInfo.mTimestamp = K32WClockSymbolsToUs(u32V2MAC_GetRxTimestamp());
+    aOtFrame->mInfo.mRxInfo.mLqi       = u8MMAC_GetRxLqi(NULL);
+    aOtFrame->mInfo.mRxInfo.mRssi      = i8Radio_GetLastPacketRSSI();
+}
+
+/**
+ * Check if a received frame is dropped by the RX filter (sRxFilter).
+ *
+ * @param[in] aRxFrame  Pointer to the received frame
+ *
+ * @return    TRUE if the frame is dropped
+ */
+static bool K32WRxFilterDrop(tsPhyFrame *aRxFrame)
+{
+    const uint8_t *psdu   = aRxFrame->uPayload.au8Byte;
+    uint16_t       fcf    = psdu[0] | (psdu[1] << 8);
+    uint8_t        offset = kFcfSize + ((fcf & kFcfSeqNbSuppresssion) ? 0 : kDsnSize);
+
+    otEXPECT(aRxFrame->u8PayloadLength >= offset);
+
+    if ((fcf & kFcfMacFrameTypeMask) == kFcfTypeBeacon)
+    {
+        otEXPECT(sRxFilter & K32W_RADIO_RX_FILTER_BEACON);
+        sRxFilterStats.beacons++;
+        return TRUE;
+    }
+
+    if (K32WIsDstPanIdPresent(fcf))
+    {
+        offset += kPanIdSize;
+    }
+
+    otEXPECT(((fcf & kFcfDstAddrMask) == kFcfDstAddrShort) && (aRxFrame->u8PayloadLength >= offset + kShortAddrSize) &&
+             ((psdu[offset] | (psdu[offset + 1] << 8)) == kShortAddrBroadcast));
+
+    /* unsecured, without source address nor IEs: the command ID follows the destination address */
+    offset += kShortAddrSize;
+
+    if (((fcf & kFcfMacFrameTypeMask) == kFcfTypeMacCommand) &&
+        !(fcf & (kFcfSecurityEnabled | kFcfIePresent | kFcfSrcAddrMask)) && (aRxFrame->u8PayloadLength > offset) &&
+        (psdu[offset] == kMacCmdBeaconRequest))
+    {
+        otEXPECT(sRxFilter & K32W_RADIO_RX_FILTER_BEACON_REQUEST);
+        sRxFilterStats.beaconRequests++;
+        return TRUE;
+    }
+
+    otEXPECT(sRxFilter & K32W_RADIO_RX_FILTER_BROADCAST);
+    sRxFilterStats.broadcasts++;
+    return TRUE;
+
+exit:
+    return FALSE;
+}
+
+/**
+ * Function used to init/reset an RX Ring Buffer
+ *
+ * @param[in] aRxRing         Pointer to an RX Ring Buffer
+ */
+static void K32WResetRxRingBuffer()
+{
+    sRxRing.head         = K32W0_RADIO_NUM_OF_RX_BUFS - 1;
+    sRxRing.tail         = K32W0_RADIO_NUM_OF_RX_BUFS - 1;
+    sRxRing.next         = 0;
+    sRxRing.last         = 0;
+    sRxRing.isRxDisabled = FALSE;
+}
+
+/**
+ * Function used to account for the end of a period in which the RX was stopped
+ * because the RX Ring buffer was full.
+ */
+static void K32WRxRingDisabledEnd()
+{
+    if (sRxRing.isRxDisabled)
+    {
+        sRxRing.isRxDisabled = FALSE;
+        sRxRingStats.rxDisabledTime += SYMBOLS_TO_US((uint64_t)(u32MMAC_GetTime() - sRxRing.rxDisabledStart));
+    }
+}
+
+/**
+ * Function used to push a received frame to the RX Ring buffer.
+ */
+static void K32WPushRxRingBuffer()
+{
+    uint16_t occupancy;
+
+    sRxRing.head = sRxRing.next;
+
+    occupancy = (sRxRing.head - sRxRing.tail) & (K32W0_RADIO_NUM_OF_RX_BUFS - 1);
+
+    if (occupancy > sRxRingStats.peakOccupancy)
+    {
+        sRxRingStats.peakOccupancy = occupancy;
+    }
+
+    sRxRingStats.frames++;
+}
+
+/**
+ * Function used to pop a received frame to the RX Ring buffer.
+ */
+static void K32WPopRxRingBuffer()
+{
+    sRxRing.tail = sRxRing.last;
+}
+
+/**
+ * Function used to get the first received frame from the RX Ring buffer.
+ */
+static rxRingBufferEntry *K32WGetRxRingBuffer()
+{
+    rxRingBufferEntry *rbe  = NULL;
+    uint16_t           tail = sRxRing.tail;
+
+    if (tail == sRxRing.head)
+    {
+        /* ring empty */
+        return NULL;
+    }
+
+    tail         = (tail + 1) & (K32W0_RADIO_NUM_OF_RX_BUFS - 1);
+    rbe          = &sRxRing.buffer[tail];
+    sRxRing.last = tail;
+
+    return rbe;
+}
+
+/**
+ * Function used to change the radio state, the time spent in the previous state
+ * is accounted when the telemetry is enabled.
+ *
+ * @param[in] aState      New radio state
+ */
+static void K32WSetState(otRadioState aState)
+{
+#if K32W0_RADIO_STATS_ENABLE
+    OSA_InterruptDisable();
+    K32WStatsAccountState();
+    sState = aState;
+    OSA_InterruptEnable();
+#else
+    sState = aState;
+#endif
+}
+
+#if K32W0_RADIO_STATS_ENABLE
+/**
+ * Function used to add the time spent in the current state since it was last
+ * accounted. Interrupts must be disabled.
+ */
+static void K32WStatsAccountState(void)
+{
+    uint64_t            now = otPlatTimeGet();
+    K32WRadioStatsState idx;
+
+    /* sState also takes the driver internal states */
+    switch ((uint32_t)sState)
+    {
+    case OT_RADIO_STATE_SLEEP:
+        idx = K32W_RADIO_STATS_STATE_SLEEP;
+        break;
+    case OT_RADIO_STATE_RECEIVE:
+        idx = K32W_RADIO_STATS_STATE_RECEIVE;
+        break;
+    case OT_RADIO_STATE_TRANSMIT:
+        idx = K32W_RADIO_STATS_STATE_TRANSMIT;
+        break;
+    case OT_RADIO_STATE_RX_DISABLED:
+        idx = K32W_RADIO_STATS_STATE_RX_DISABLED;
+        break;
+    case OT_RADIO_STATE_ED_SCAN:
+        idx = K32W_RADIO_STATS_STATE_ED_SCAN;
+        break;
+    default:
+        idx = K32W_RADIO_STATS_STATE_DISABLED;
+        break;
+    }
+
+    sRadioStats.stateTime[idx] += now - sStatsStateStart;
+    sStatsStateStart = now;
+}
+
+/**
+ * Function used to add an execution time to a histogram.
+ *
+ * @param[in] aHist       Histogram of K32W_RADIO_STATS_NUM_OF_BINS bins
+ * @param[in] aMaxCycles  Longest execution time, updated if needed
+ * @param[in] aCycles     Execution time in CPU cycles
+ */
+static void K32WStatsAddCycles(uint32_t *aHist, uint32_t *aMaxCycles, uint32_t aCycles)
+{
+    uint8_t bin = 0;
+
+    if (aCycles >= 256)
+    {
+        /* 256 cycles -> bin 1 */
+        bin = MIN(32 - __builtin_clz(aCycles) - 8, K32W_RADIO_STATS_NUM_OF_BINS - 1);
+    }
+
+    aHist[bin]++;
+
+    if (aCycles > *aMaxCycles)
+    {
+        *aMaxCycles = aCycles;
+    }
+}
+#endif
+
+/**
+ * Write the channel and TX power to the radio if they differ from the ones already written.
+ * Should be called when radio is idle.
+ *
+ * @param[in] aChannel  Channel
+ * @param[in] aPower    TX power (dBm)
  *
  */
-static bool K32WCheckIfFpRequired(tsPhyFrame *aRxFrame)
+static void K32WModemSetChannelAndPower(uint8_t aChannel, int8_t aPower)
 {
-    bool         isFpRequired = FALSE;
-    uint8_t      idx          = 0;
-    otRadioFrame f;
-    otMacAddress srcAddr;
-
-    f.mPsdu   = aRxFrame->uPayload.au8Byte;
-    f.mLength = aRxFrame->u8PayloadLength;
-
-    if (!(
-#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-            /* Enhanced frame pending */
-            (otMacFrameIsVersion2015(&f) && otMacFrameIsCommand(&f)) || otMacFrameIsData(&f) ||
-#endif
-            otMacFrameIsDataRequest(&f)))
+    if (!(sModemShadow.validMask & kModemChannelAndPower) || (sModemShadow.channel != aChannel) ||
+        (sModemShadow.power != aPower))
     {
-        return FALSE;
+        vMMAC_SetChannelAndPower(aChannel, aPower);
+        sModemShadow.channel = aChannel;
+        sModemShadow.power   = aPower;
+        sModemShadow.validMask |= kModemChannelAndPower;
     }
-
-    if (!sIsFpEnabled)
+    else if (sIsWakePending)
     {
-        return TRUE;
+        sWakeStats.writesSkipped++;
     }
+}
 
-    if (otMacFrameGetSrcAddr(&f, &srcAddr))
+static void K32WModemSetPanId(uint16_t aPanId)
+{
+    if (!(sModemShadow.validMask & kModemPanId) || (sModemShadow.panId != aPanId))
     {
-        return FALSE;
+        vMMAC_SetRxPanId(aPanId);
+        sModemShadow.panId = aPanId;
+        sModemShadow.validMask |= kModemPanId;
     }
-
-    if (srcAddr.mType == OT_MAC_ADDRESS_TYPE_NONE)
+    else if (sIsWakePending)
     {
-        isFpRequired = TRUE;
+        sWakeStats.writesSkipped++;
     }
-    else if (srcAddr.mType == OT_MAC_ADDRESS_TYPE_SHORT)
+}
+
+static void K32WModemSetShortAddr(uint16_t aShortAddress)
+{
+    if (!(sModemShadow.validMask & kModemShortAddr) || (sModemShadow.shortAddr != aShortAddress))
     {
-        for (idx = 0; idx < MAX_FP_ADDRS; idx++)
-        {
-            if (BIT_TST(sFpShortAddrMask, idx) && (sFpShortAddr[idx].macAddress == srcAddr.mAddress.mShortAddress))
-            {
-                isFpRequired = TRUE;
-                break;
-            }
-        }
+        vMMAC_SetRxShortAddr(aShortAddress);
+        sModemShadow.shortAddr = aShortAddress;
+        sModemShadow.validMask |= kModemShortAddr;
     }
-    else if (srcAddr.mType == OT_MAC_ADDRESS_TYPE_EXTENDED)
+    else if (sIsWakePending)
     {
-        /* srcAddr.mAddress.mExtAddress is returned in reverse order (big endian) */
-        uint64_t v = otEncodingReadUint64Le(srcAddr.mAddress.mExtAddress.m8);
-
-        for (idx = 0; idx < MAX_FP_ADDRS; idx++)
-        {
-            uint64_t t = otEncodingReadUint64Le(sFpExtAddr[idx].extAddr.m8);
+        sWakeStats.writesSkipped++;
+    }
+}
 
-            if (BIT_TST(sFpExtAddrMask, idx) && (t == v))
-            {
-                isFpRequired = TRUE;
-                break;
-            }
-        }
+static void K32WModemSetExtAddr(const tsExtAddr *aExtAddress)
+{
+    if (!(sModemShadow.validMask & kModemExtAddr) || (sModemShadow.extAddr.u32L != aExtAddress->u32L) ||
+        (sModemShadow.extAddr.u32H != aExtAddress->u32H))
+    {
+        vMMAC_SetRxExtendedAddr((tsExtAddr *)aExtAddress);
+        sModemShadow.extAddr = *aExtAddress;
+        sModemShadow.validMask |= kModemExtAddr;
+    }
+    else if (sIsWakePending)
+    {
+        sWakeStats.writesSkipped++;
     }
+}
 
-    return isFpRequired;
+#if K32W0_RADIO_SNIFFER_ENABLE
+/**
+ * Function used to start receiving in the sniffer ring. The frame is received
+ * directly in the head entry, which is reused if the ring is full.
+ */
+static void K32WSnifferEnableReceive(void)
+{
+    vMMAC_StartV2MacReceive(&sSnifferEntries[sSnifferRing.head].f, sSnifferRxOpt);
 }
 
 /**
- * Process RX frames in process context and call the upper layer call-backs
+ * Handle the RX interrupts in sniffer mode
  *
- * @param[in] aInstance  Pointer to OT instance
+ * @param[in] u32IntBitmap  Bitmap telling which interrupt fired
+ *
+ * @return    TRUE          The reception is over and the radio is idle
+ * @return    FALSE         The reception is still ongoing
  */
-static void K32WProcessRxFrames(otInstance *aInstance)
+static bool_t K32WSnifferRxIsr(uint32_t u32IntBitmap)
 {
-    rxRingBufferEntry *rbe = NULL;
+    snifferEntry *entry = &sSnifferEntries[sSnifferRing.head];
+    uint16_t      next  = (sSnifferRing.head + 1) & (K32W0_RADIO_SNIFFER_NUM_OF_BUFS - 1);
 
-    while ((rbe = K32WGetRxRingBuffer()) != NULL)
+    if (!(u32IntBitmap & E_MMAC_INT_RX_COMPLETE))
     {
-        otPlatRadioReceiveDone(aInstance, &rbe->of, OT_ERROR_NONE);
+        return FALSE;
+    }
 
-        K32WPopRxRingBuffer();
+    if (0 == u32V2MAC_GetRxErrors())
+    {
+        entry->timestamp = K32WClockSymbolsToUs(u32V2MAC_GetRxTimestamp());
+        entry->lqi       = u8MMAC_GetRxLqi(NULL);
+        entry->rssi      = i8Radio_GetLastPacketRSSI();
+        entry->channel   = sChannel;
 
-        if (sState == OT_RADIO_STATE_RX_DISABLED)
+        if (next == sSnifferRing.tail)
         {
-            sState = OT_RADIO_STATE_RECEIVE;
-            K32WEnableReceive();
+            /* the output doesn't keep up, the frame is dropped */
+            sSnifferStats.overflows++;
+        }
+        else
+        {
+            sSnifferRing.head = next;
+            sSnifferStats.frames++;
         }
     }
 
-    if (sState == OT_RADIO_STATE_RX_DISABLED)
-    {
-        sState = OT_RADIO_STATE_RECEIVE;
-        K32WEnableReceive();
-    }
+    return TRUE;
 }
 
 /**
- * Process TX frame in process context and call the upper layer call-backs
- *
- * @param[in] aInstance  Pointer to OT instance
+ * Stream the captured frames as pcap records, IEEE 802.15.4 TAP link type.
  */
-static void K32WProcessTxFrame(otInstance *aInstance)
-{
-    if (sTxDone)
+static void K32WProcessSnifferFrames(void)
+{
+    pcapRecordHdr hdr = {
+        .tapLength     = sizeof(pcapRecordHdr) - offsetof(pcapRecordHdr, tapVersion),
+        .fcsType       = TAP_TLV_FCS_TYPE,
+        .fcsLength     = sizeof(uint8_t),
+        .fcs           = 0, /* the FCS is not kept by the MAC, the 2 last bytes are not written */
+        .rssType       = TAP_TLV_RSS,
+        .rssLength     = sizeof(float),
+        .lqiType       = TAP_TLV_LQI,
+        .lqiLength     = sizeof(uint8_t),
+        .channelType   = TAP_TLV_CHANNEL,
+        .channelLength = sizeof(uint16_t) + sizeof(uint8_t),
+        .page          = 0,
+    };
+
+    while (sSnifferRing.tail != sSnifferRing.head)
     {
-        sTxDone = FALSE;
-        if ((sTxOtFrame.mPsdu[kMacFcfLowOffset] & kFcfAckRequest) && (OT_ERROR_NONE == sTxStatus))
-        {
-            otPlatRadioTxDone(aInstance, &sTxOtFrame, &sAckOtFrame, sTxStatus);
-        }
-        else
-        {
-            otPlatRadioTxDone(aInstance, &sTxOtFrame, NULL, sTxStatus);
-        }
+        snifferEntry *entry = &sSnifferEntries[sSnifferRing.tail];
+        uint8_t       len   = entry->f.u8PayloadLength - kFcsSize;
+
+        hdr.tsSec   = (uint32_t)(entry->timestamp / 1000000);
+        hdr.tsUsec  = (uint32_t)(entry->timestamp % 1000000);
+        hdr.inclLen = hdr.tapLength + len;
+        hdr.origLen = hdr.inclLen;
+        hdr.rss     = entry->rssi;
+        hdr.lqi     = entry->lqi;
+        hdr.channel = entry->channel;
+
+        K32WSnifferOutput((const uint8_t *)&hdr, sizeof(hdr));
+        K32WSnifferOutput(entry->f.uPayload.au8Byte, len);
+
+        sSnifferRing.tail = (sSnifferRing.tail + 1) & (K32W0_RADIO_SNIFFER_NUM_OF_BUFS - 1);
     }
 }
+#endif
 
-static void K32WGetRxFrameInfo(rxRingBufferEntry *rbe)
+/**
+ * Sync the mapping between the MMAC symbol clock and otPlatTimeGet() on a pair of readings of both
+ * clocks. The slope (drift of the 32 MHz clock against the timestamp timer) is estimated from the
+ * time elapsed since the previous sync. Cheap if called before K32W0_RADIO_CLOCK_SYNC_PERIOD_US.
+ */
+static void K32WClockSync(void)
 {
-    memset(&rbe->of.mInfo.mRxInfo, 0, sizeof(rbe->of.mInfo.mRxInfo));
+    uint64_t us;
+    uint32_t sym;
+    uint64_t elapsedUs;
+    uint32_t elapsedSym;
 
-    /* must be called after Rx complete to get correct values from MAC */
-    K32WFrameConversion(&rbe->f, &rbe->of);
+    /* the paired reads are only done when a sync is due */
+    otEXPECT(!sClockMap.isValid || (otPlatTimeGet() >= sClockMap.nextSyncUs));
 
-    rbe->of.mChannel                             = sChannel; /* Rx channel */
-    rbe->of.mInfo.mRxInfo.mAckedWithFramePending = (bool)rbe->f.au8Padding[0];
+    OSA_InterruptDisable();
 
-#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
-    if (sCslPeriod)
+    /* both clocks are read close together, the symbol read is in the middle of the time reads */
+    us  = otPlatTimeGet();
+    sym = u32MMAC_GetTime();
+    us += (otPlatTimeGet() - us) / 2;
+
+    elapsedUs  = us - sClockMap.anchorUs;
+    elapsedSym = sym - sClockMap.anchorSym;
+
+    if (!sClockMap.isValid || (elapsedUs >= K32W0_RADIO_CLOCK_SYNC_PERIOD_US))
     {
-        uint8_t keyId;
+        uint32_t slope = sClockMap.slopeQ16;
 
-        if (otMacFrameIsVersion2015(&rbe->of) && otMacFrameIsAckRequested(&rbe->of) &&
-            otMacFrameIsSecurityEnabled(&rbe->of) && otMacFrameIsKeyIdMode1(&rbe->of) &&
-            ((keyId = otMacFrameGetKeyId(&rbe->of)) != 0) &&
-            ((keyId == sKeyId) || (keyId == sKeyId - 1) || (keyId == sKeyId + 1)))
+        if (sClockMap.isValid && (elapsedSym != 0) && (elapsedUs < UINT32_MAX / 2))
         {
-            rbe->of.mInfo.mRxInfo.mAckedWithSecEnhAck = true;
-            rbe->of.mInfo.mRxInfo.mAckKeyId           = keyId;
-            rbe->of.mInfo.mRxInfo.mAckFrameCounter    = sMacFrameCounter;
-            sMacFrameCounter++;
+            int32_t measured = (int32_t)((elapsedUs << 16) / elapsedSym);
+
+            slope = (uint32_t)((int32_t)slope + ((measured - (int32_t)slope) >> K32W_CLOCK_DRIFT_FILTER_SHIFT));
         }
+
+        if (!sClockMap.isValid ||
+            (slope > K32W_CLOCK_NOMINAL_SLOPE + K32W_CLOCK_MAX_DRIFT) ||
+            (slope < K32W_CLOCK_NOMINAL_SLOPE - K32W_CLOCK_MAX_DRIFT))
+        {
+            /* first sync or clock restart: start again from the nominal symbol duration */
+            slope = K32W_CLOCK_NOMINAL_SLOPE;
+        }
+
+        sClockMap.anchorSym   = sym;
+        sClockMap.anchorUs    = us;
+        sClockMap.nextSyncUs  = us + K32W0_RADIO_CLOCK_SYNC_PERIOD_US;
+        sClockMap.slopeQ16    = slope;
+        sClockMap.symPerUsQ32 = (uint32_t)((1ULL << 48) / slope);
+        sClockMap.isValid     = TRUE;
     }
-#endif
+
+    OSA_InterruptEnable();
+
+exit:
+    return;
 }
 
 /**
- * aMacFormatFrame <-> aOtFrame bidirectional conversion
+ * Convert an MMAC time to otPlatTimeGet() time.
  *
- * @param[in] data             Pointer to frame or ring buffer entry
- * @param[in] aOtFrame         Pointer to OpenThread Frame
+ * @param[in] aSymbols  MMAC time (symbols), up to 2^31 symbols away from the last sync
+ *
+ * @return    The corresponding otPlatTimeGet() time (us)
  */
-static void K32WFrameConversion(tsPhyFrame *aPhyFrame, otRadioFrame *aOtFrame)
+static uint64_t K32WClockSymbolsToUs(uint32_t aSymbols)
 {
-    aOtFrame->mLength = aPhyFrame->u8PayloadLength;
-    aOtFrame->mInfo.mRxInfo.mTimestamp =
-        otPlatTimeGet() - (uint64_t)(u32MMAC_GetTime() - u32V2MAC_GetRxTimestamp()) * US_PER_SYMBOL;
-    aOtFrame->mInfo.mRxInfo.mLqi  = u8MMAC_GetRxLqi(NULL);
-    aOtFrame->mInfo.mRxInfo.mRssi = i8Radio_GetLastPacketRSSI();
+    if (!sClockMap.isValid)
+    {
+        K32WClockSync();
+    }
+
+    return sClockMap.anchorUs +
+           (uint64_t)(((int64_t)(int32_t)(aSymbols - sClockMap.anchorSym) * sClockMap.slopeQ16) >> 16);
 }
 
 /**
- * Function used to init/reset an RX Ring Buffer
+ * Get the MMAC time elapsed from the last sync to an otPlatTimeGet() time.
  *
- * @param[in] aRxRing         Pointer to an RX Ring Buffer
+ * @param[in] aUs  The 32 lower bits of an otPlatTimeGet() time (us), up to 2^31 us away from the last sync
+ *
+ * @return    The MMAC time from the last sync (sClockMap.anchorSym) to aUs in 1/16 symbols
  */
-static void K32WResetRxRingBuffer()
+static int64_t K32WClockUsDeltaQ4(uint32_t aUs)
 {
-    sRxRing.head    = K32W0_RADIO_NUM_OF_RX_BUFS - 1;
-    sRxRing.tail    = K32W0_RADIO_NUM_OF_RX_BUFS - 1;
-    sRxRing.next    = 0;
-    sRxRing.last    = 0;
-    sRxRing.ovf_cnt = 0;
-}
+    if (!sClockMap.isValid)
+    {
+        K32WClockSync();
+    }
 
-/**
- * Function used to push a received frame to the RX Ring buffer.
- */
-static void K32WPushRxRingBuffer()
-{
-    sRxRing.head = sRxRing.next;
+    /* Q32 symbols to Q4 symbols */
+    return ((int64_t)(int32_t)(aUs - (uint32_t)sClockMap.anchorUs) * sClockMap.symPerUsQ32) >> 28;
 }
 
 /**
- * Function used to pop a received frame to the RX Ring buffer.
+ * Function used to check if the cached RSSI can be reported instead of measuring it.
+ * The cache is used only while receiving, when measuring would stop the receiver.
+ *
+ * @return    TRUE              sRssiCache can be used
+ * @return    FALSE             the RSSI should be measured
  */
-static void K32WPopRxRingBuffer()
+static bool_t K32WRssiCacheIsValid(void)
 {
-    sRxRing.tail = sRxRing.last;
+#if K32W0_RADIO_RSSI_CACHE_TIME_US
+    return (sState == OT_RADIO_STATE_RECEIVE) && (sRssiCache != OT_RADIO_RSSI_INVALID) &&
+           (sRssiCacheChannel == sChannel) &&
+           ((u32MMAC_GetTime() - sRssiCacheTime) < (K32W0_RADIO_RSSI_CACHE_TIME_US / US_PER_SYMBOL));
+#else
+    return FALSE;
+#endif
 }
 
 /**
- * Function used to get the first received frame from the RX Ring buffer.
+ * Function used to save the latest channel energy measured on the current channel.
+ *
+ * @param[in] aRssi           RSSI in dBm
  */
-static rxRingBufferEntry *K32WGetRxRingBuffer()
+static void K32WRssiCacheUpdate(int8_t aRssi)
 {
-    rxRingBufferEntry *rbe  = NULL;
-    uint16_t           tail = sRxRing.tail;
-
-    if (tail == sRxRing.head)
-    {
-        /* ring empty */
-        return NULL;
-    }
-
-    tail         = (tail + 1) & (K32W0_RADIO_NUM_OF_RX_BUFS - 1);
-    rbe          = &sRxRing.buffer[tail];
-    sRxRing.last = tail;
-
-    return rbe;
+    sRssiCache        = aRssi;
+    sRssiCacheChannel = sChannel;
+    sRssiCacheTime    = u32MMAC_GetTime();
 }
 
 /**
@@ -1352,18 +2987,50 @@ static void K32WEnableReceive()
     tsPhyFrame *pRxFrame = NULL;
     uint16_t    next     = (sRxRing.head + 1) & (K32W0_RADIO_NUM_OF_RX_BUFS - 1);
 
+    K32WApplyPendingChannel();
+
+#if K32W0_RADIO_SNIFFER_ENABLE
+    if (sIsSnifferEnabled)
+    {
+        K32WSnifferEnableReceive();
+        return;
+    }
+#endif
+
     if (next == sRxRing.tail)
     {
         /* ring full */
-        sState = OT_RADIO_STATE_RX_DISABLED;
-        sRxRing.ovf_cnt++;
+        K32WSetState(OT_RADIO_STATE_RX_DISABLED);
+        sRxRingStats.overflows++;
+
+        if (!sRxRing.isRxDisabled)
+        {
+            sRxRing.isRxDisabled    = TRUE;
+            sRxRing.rxDisabledStart = u32MMAC_GetTime();
+        }
         return;
     }
 
+    K32WRxRingDisabledEnd();
+
     pRxFrame     = &sRxRing.buffer[next].f;
     sRxRing.next = next;
 
     vMMAC_StartV2MacReceive(pRxFrame, sRxOpt);
+
+    if (sIsWakePending)
+    {
+        uint32_t latency = (uint32_t)(otPlatTimeGet() - sWakeStart);
+
+        sIsWakePending = FALSE;
+        sWakeStats.lastWakeToRxUs = latency;
+        sWakeStats.totalWakeToRxUs += latency;
+
+        if (latency > sWakeStats.maxWakeToRxUs)
+        {
+            sWakeStats.maxWakeToRxUs = latency;
+        }
+    }
 }
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -1415,8 +3082,10 @@ void otPlatRadioUpdateCslSampleTime(otInstance *aInstance, uint32_t aCslSampleTi
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    /* aCslSampleTime is the next channel sample so in the future of the current Rx */
-    aCslSampleTime = u32MMAC_GetTime() * US_PER_SYMBOL + (aCslSampleTime - (uint32_t)otPlatTimeGet());
+    /* aCslSampleTime is the next channel sample so in the future of the current Rx.
+       The MMAC expects it in symbols * US_PER_SYMBOL, with the sub-symbol part. */
+    int64_t delta  = K32WClockUsDeltaQ4(aCslSampleTime);
+    aCslSampleTime = sClockMap.anchorSym * US_PER_SYMBOL + (uint32_t)delta;
 
     V2MMAC_SetCslSampleTime(aCslSampleTime);
 }
@@ -1466,44 +3135,50 @@ exit:
     return error;
 }
 
+/**
+ * Compute the Enhanced ACK probing IE of a received frame. The IE is generated once, here, and
+ * kept for K32WGetVsIeGen() which is called next by the MAC for the same frame.
+ *
+ * @param[in] t    Pointer to the received frame
+ *
+ * @return    Length of the IE, 0 if no IE is needed
+ *
+ */
 static uint8_t K32WGetVsIeLen(void *t)
 {
-    uint8_t      len;
+    uint8_t      data[OT_ENH_PROBING_IE_DATA_MAX_SIZE];
+    uint8_t      len = 0;
     otRadioFrame f;
     otMacAddress dstAddr;
 
+    sEnhAckIe.frame = NULL;
+
     f.mPsdu   = ((tsPhyFrame *)t)->uPayload.au8Byte;
     f.mLength = ((tsPhyFrame *)t)->u8PayloadLength;
 
     otMacFrameGetDstAddr(&f, &dstAddr);
-    if ((len = otLinkMetricsEnhAckGetDataLen(&dstAddr)) > 0)
-    {
-        uint8_t tmp[OT_ACK_IE_MAX_SIZE];
+    otEXPECT(otLinkMetricsEnhAckGetDataLen(&dstAddr) > 0);
 
-        len = otMacFrameGenerateEnhAckProbingIe(tmp, NULL, len);
-    }
+    len = otLinkMetricsEnhAckGenData(&dstAddr, u8MMAC_GetRxLqi(NULL), i8Radio_GetLastPacketRSSI(), data);
+    otEXPECT(len > 0);
 
+    len             = otMacFrameGenerateEnhAckProbingIe(sEnhAckIe.ie, data, len);
+    sEnhAckIe.len   = len;
+    sEnhAckIe.frame = t;
+
+exit:
     return len;
 }
 
 static void K32WGetVsIeGen(void *t, uint8_t *b)
 {
-    uint8_t      tmp[OT_ENH_PROBING_IE_DATA_MAX_SIZE];
-    uint8_t      len;
-    otRadioFrame f;
-    otMacAddress dstAddr;
-
-    uint8_t lqi  = u8MMAC_GetRxLqi(NULL);
-    int8_t  rssi = i8Radio_GetLastPacketRSSI();
-
-    f.mPsdu   = ((tsPhyFrame *)t)->uPayload.au8Byte;
-    f.mLength = ((tsPhyFrame *)t)->u8PayloadLength;
-
-    otMacFrameGetDstAddr(&f, &dstAddr);
-    if ((len = otLinkMetricsEnhAckGenData(&dstAddr, lqi, rssi, tmp)) > 0)
+    /* the IE is computed again only if K32WGetVsIeLen() was not called for this frame */
+    if ((sEnhAckIe.frame == t) || (K32WGetVsIeLen(t) > 0))
     {
-        otMacFrameGenerateEnhAckProbingIe(b, tmp, len);
+        memcpy(b, sEnhAckIe.ie, sEnhAckIe.len);
     }
+
+    sEnhAckIe.frame = NULL;
 }
 #endif
 
@@ -1536,9 +3211,10 @@ otError otPlatRadioSetCoexEnabled(otInstance *aInstance, bool aEnabled)
         }
         else
         {
-            vDynEnableCoex((void *)MWS_CoexistenceRegister, (void *)MWS_CoexistenceRequestAccess,
-                           (void *)MWS_CoexistenceSetPriority, (void *)MWS_CoexistenceReleaseAccess,
-                           (void *)MWS_CoexistenceChangeAccess);
+            /* The MAC accesses the arbiter through wrappers which collect the metrics */
+            vDynEnableCoex((void *)MWS_CoexistenceRegister, (void *)K32WCoexRequestAccess,
+                           (void *)MWS_CoexistenceSetPriority, (void *)K32WCoexReleaseAccess,
+                           (void *)K32WCoexChangeAccess);
             isCoexInitialized = true;
         }
     }
@@ -1568,8 +3244,112 @@ otError otPlatRadioGetCoexMetrics(otInstance *aInstance, otRadioCoexMetrics *aCo
     otError error = OT_ERROR_NONE;
     OT_UNUSED_VARIABLE(aInstance);
 
-    assert(aCoexMetrics != NULL);
+    otEXPECT_ACTION(aCoexMetrics != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    OSA_InterruptDisable();
+
+    *aCoexMetrics = sCoexMetrics;
 
+    OSA_InterruptEnable();
+
+exit:
     return error;
 }
+
+/**
+ * Wrapper of MWS_CoexistenceRequestAccess() called by the MAC before each RX/TX sequence.
+ * The request doesn't block: the access is either granted on return or denied.
+ *
+ * @param[in] aState  RF state for which the access is requested
+ *
+ * @return    Status returned by the MWS
+ */
+static mwsStatus_t K32WCoexRequestAccess(mwsRfState_t aState)
+{
+    mwsStatus_t status = MWS_CoexistenceRequestAccess(aState);
+
+    K32WCoexUpdateMetrics(aState, status, false);
+
+    return status;
+}
+
+/**
+ * Wrapper of MWS_CoexistenceChangeAccess() called by the MAC when switching
+ * between RX and TX (e.g.: sending an ACK) while holding the access.
+ *
+ * @param[in] aState  New RF state
+ *
+ * @return    Status returned by the MWS
+ */
+static mwsStatus_t K32WCoexChangeAccess(mwsRfState_t aState)
+{
+    mwsStatus_t status = MWS_CoexistenceChangeAccess(aState);
+
+    K32WCoexUpdateMetrics(aState, status, true);
+
+    return status;
+}
+
+/**
+ * Wrapper of MWS_CoexistenceReleaseAccess() called by the MAC at the end of each RX/TX sequence.
+ */
+static void K32WCoexReleaseAccess(void)
+{
+    sCoexState = gMWS_IdleState_c;
+    MWS_CoexistenceReleaseAccess();
+}
+
+/**
+ * Update the coexistence metrics with the result of an access request. The MWS
+ * doesn't report when a denied access is granted later on, so the grant wait
+ * counters and the average request to grant times are not filled. Denied TX
+ * requests are the TX requests not granted immediately.
+ *
+ * @param[in] aState     Requested RF state
+ * @param[in] aStatus    Status returned by the MWS
+ * @param[in] aIsChange  TRUE if the access was already granted for another RF state
+ */
+static void K32WCoexUpdateMetrics(mwsRfState_t aState, mwsStatus_t aStatus, bool aIsChange)
+{
+    bool granted = (aStatus == gMWS_Success_c);
+
+    /* Counters are not updated anymore once one of them saturates */
+    otEXPECT(!sCoexMetrics.mStopped);
+
+    if (aIsChange && !granted && (sCoexState != gMWS_IdleState_c))
+    {
+        /* the grant was removed while it was in use */
+        sCoexMetrics.mNumGrantGlitch++;
+    }
+
+    if (aState == gMWS_TxState_c)
+    {
+        sCoexMetrics.mNumTxRequest++;
+
+        if (granted)
+        {
+            sCoexMetrics.mNumTxGrantImmediate++;
+        }
+
+        sCoexMetrics.mStopped = (sCoexMetrics.mNumTxRequest == UINT32_MAX);
+    }
+    else if (aState == gMWS_RxState_c)
+    {
+        sCoexMetrics.mNumRxRequest++;
+
+        if (granted)
+        {
+            sCoexMetrics.mNumRxGrantImmediate++;
+        }
+        else
+        {
+            sCoexMetrics.mNumRxGrantNone++;
+        }
+
+        sCoexMetrics.mStopped = (sCoexMetrics.mNumRxRequest == UINT32_MAX);
+    }
+
+exit:
+    sCoexState = granted ? aState : gMWS_IdleState_c;
+}
 #endif /* OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE */
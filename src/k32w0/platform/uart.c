@@ -38,6 +38,9 @@
 #include "fsl_flexcomm.h"
 #include "fsl_reset.h"
 #include "fsl_usart.h"
+#if (UART_USE_DRIVER_RX_DMA || UART_USE_DRIVER_TX_DMA)
+#include "fsl_dma.h"
+#endif
 
 /* Openthread general includes */
 #include "fsl_debug_console.h"
@@ -57,6 +60,14 @@
 #error "Serial Manager and Uart driver cannot be used at the same time. Please choose just one."
 #endif
 
+#if ((UART_USE_DRIVER_RX_DMA == 1) && (UART_USE_DRIVER == 0))
+#error "UART RX DMA mode requires the Uart driver."
+#endif
+
+#if ((UART_USE_DRIVER_TX_DMA == 1) && (UART_USE_DRIVER == 0))
+#error "UART TX DMA mode requires the Uart driver."
+#endif
+
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
 #if ((UART_USE_DRIVER_LOG == 0) && (UART_USE_SERIAL_MGR_LOG == 0) && (UART_USE_SWO_LOG == 0))
 #error "No output interface enabled for OpenThread logging. Please choose just one."
@@ -90,6 +101,91 @@
 #define OT_PLAT_APP_UART_INSTANCE 0
 #endif
 
+#if UART_USE_DRIVER_RX_DMA
+/* DMA request line of the USART0 receiver */
+#ifndef OT_PLAT_UART_RX_DMA_CHANNEL
+#define OT_PLAT_UART_RX_DMA_CHANNEL 0
+#endif
+
+/*
+ * Size of the circular buffer the DMA writes received characters to. The DMA wraps around it on its own, so this needs
+ * to cover the bytes that can arrive between two K32WUartProcess() calls and while they are parsed: 1024 bytes last
+ * about 10 ms at 1 Mbaud.
+ */
+#ifndef OT_PLAT_UART_RX_DMA_BUFFER_SIZE
+#define OT_PLAT_UART_RX_DMA_BUFFER_SIZE 1024
+#endif
+
+#if ((OT_PLAT_UART_RX_DMA_BUFFER_SIZE & (OT_PLAT_UART_RX_DMA_BUFFER_SIZE - 1)) != 0) || \
+    (OT_PLAT_UART_RX_DMA_BUFFER_SIZE > 1024)
+#error "OT_PLAT_UART_RX_DMA_BUFFER_SIZE must be a power of 2 and at most 1024 (DMA transfer limit)."
+#endif
+#endif
+
+#if UART_USE_DRIVER_TX_DMA
+/* DMA request line of the USART0 transmitter */
+#ifndef OT_PLAT_UART_TX_DMA_CHANNEL
+#define OT_PLAT_UART_TX_DMA_CHANNEL 1
+#endif
+
+/*
+ * Number of otPlatUartSend() buffers that can be queued for the DMA. OpenThread keeps a single buffer outstanding until
+ * otPlatUartSendDone(), the extra entries (8 bytes each) let application code sharing the app UART queue its own
+ * buffers behind it instead of getting OT_ERROR_BUSY.
+ */
+#ifndef OT_PLAT_UART_TX_QUEUE_SIZE
+#define OT_PLAT_UART_TX_QUEUE_SIZE 4
+#endif
+
+/* Longest single DMA transfer, longer buffers are sent in several chunks */
+#define UART_TX_DMA_MAX_CHUNK 1024
+#endif
+
+/*
+ * Set to 1 to enable the RTS/CTS hardware flow control of the app UART (Uart driver only). The board must route the
+ * USART0 RTS and CTS signals in BOARD_Init_UART_Pins().
+ */
+#ifndef OT_PLAT_UART_HW_FLOW_CONTROL
+#define OT_PLAT_UART_HW_FLOW_CONTROL 0
+#endif
+
+#if UART_USE_DRIVER_RX_DMA
+#define UART_RX_FLOW_BUFFER_SIZE OT_PLAT_UART_RX_DMA_BUFFER_SIZE
+#else
+#define UART_RX_FLOW_BUFFER_SIZE OT_PLAT_UART_RX_BUFFER_SIZE
+#endif
+
+/*
+ * RX buffer levels at which the receiver stops emptying the RX FIFO, letting the USART deassert RTS once the FIFO is
+ * full, and at which the process context restarts it. The RX FIFO is emptied by the ISR into the RX Ring buffer, or by
+ * the DMA into its circular buffer (UART_USE_DRIVER_RX_DMA).
+ */
+#ifndef OT_PLAT_UART_RX_FLOW_OFF_LEVEL
+#define OT_PLAT_UART_RX_FLOW_OFF_LEVEL ((UART_RX_FLOW_BUFFER_SIZE * 3) / 4)
+#endif
+
+#ifndef OT_PLAT_UART_RX_FLOW_ON_LEVEL
+#define OT_PLAT_UART_RX_FLOW_ON_LEVEL (UART_RX_FLOW_BUFFER_SIZE / 4)
+#endif
+
+#if UART_USE_DRIVER_RX_DMA
+/*
+ * Number of blocks the DMA circular buffer is split into. The DMA raises an interrupt at the end of each block, which
+ * is where the buffer level is checked against OT_PLAT_UART_RX_FLOW_OFF_LEVEL.
+ */
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+#define UART_RX_DMA_NUM_OF_BLOCKS 4
+#else
+#define UART_RX_DMA_NUM_OF_BLOCKS 1
+#endif
+#define UART_RX_DMA_BLOCK_SIZE (OT_PLAT_UART_RX_DMA_BUFFER_SIZE / UART_RX_DMA_NUM_OF_BLOCKS)
+
+#if OT_PLAT_UART_HW_FLOW_CONTROL && \
+    (OT_PLAT_UART_RX_FLOW_OFF_LEVEL > OT_PLAT_UART_RX_DMA_BUFFER_SIZE - UART_RX_DMA_BLOCK_SIZE)
+#error "OT_PLAT_UART_RX_FLOW_OFF_LEVEL must leave a DMA block free in OT_PLAT_UART_RX_DMA_BUFFER_SIZE."
+#endif
+#endif
+
 #if (UART_USE_SWO_LOG == 1)
 /* For a different SWO pin, please update the necessary pin number and functionality */
 #ifndef SWO_LOG_PIN
@@ -110,6 +206,18 @@ typedef struct
     bool    isFull;
 } rxRingBuffer;
 
+typedef struct
+{
+    uint8_t *buffer;
+    uint16_t length;
+} rxRingSpan;
+
+typedef struct
+{
+    const uint8_t *buffer;
+    uint16_t       length;
+} txQueueEntry;
+
 /* Enums */
 typedef enum
 {
@@ -122,10 +230,24 @@ typedef void (*pSerialCallBack_t)(void *param);
 /* Private functions declaration */
 static void     K32WProcessReceive();
 static void     K32WProcessTransmit();
+#if UART_USE_DRIVER_RX_DMA
+static void     K32WUartRxDmaInit(void);
+static uint32_t K32WUartRxDmaGetWritePos(void);
+static bool     K32WUartIsReceiving(void);
+static void     K32WUartRxDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+#else
 static void     K32WResetRxRingBuffer(rxRingBuffer *aRxRing);
-static uint8_t *K32WPopRxRingBuffer(rxRingBuffer *aRxRing);
-static bool     K32WIsEmptyRxRingBuffer(rxRingBuffer *aRxRing);
+static uint16_t K32WGetRxRingBufferLevel(const rxRingBuffer *aRxRing);
+static uint16_t K32WPeekRxRingBuffer(rxRingBuffer *aRxRing, rxRingSpan aSpans[2]);
+static void     K32WReleaseRxRingBuffer(rxRingBuffer *aRxRing, uint16_t aCount);
 static void     K32WPushRxRingBuffer(rxRingBuffer *aRxRing, uint8_t aCharacter);
+#endif
+#if UART_USE_DRIVER_TX_DMA
+static void     K32WUartTxDmaInit(void);
+static void     K32WUartTxDmaStartNext(void);
+static void     K32WUartTxDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode);
+#endif
+static bool     K32WUartIsTransmitting(void);
 static void     USART0_IRQHandler(USART_Type *base, usart_handle_t *handle);
 #endif
 
@@ -143,8 +265,39 @@ static bool sIsUartInitialized; /* Is UART module initialized? */
 #if UART_USE_DRIVER
 static bool           sIsTransmitDone; /* Transmit done for the latest user-data buffer */
 static usart_handle_t sUartHandleApp;  /* Handle to the UART module */
+#if UART_USE_DRIVER_RX_DMA
+static dma_handle_t      sUartRxDmaHandle;                                 /* Handle to the RX DMA channel */
+static uint8_t           sUartRxDmaBuffer[OT_PLAT_UART_RX_DMA_BUFFER_SIZE]; /* Circular buffer written by the DMA */
+static volatile uint32_t sUartRxDmaBlocks;                                 /* Number of completed blocks */
+static volatile uint32_t sUartRxDmaReadPos;                                /* Bytes consumed since enable */
+#else
 static rxRingBuffer   sUartRxRing0;    /* Receive Ring Buffer */
 #endif
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+static volatile bool sIsRxFlowOff; /* The receiver stopped emptying the RX FIFO */
+#endif
+static K32WUartRxStats sUartRxStats;
+
+#if UART_USE_DRIVER_TX_DMA
+static dma_handle_t     sUartTxDmaHandle;                        /* Handle to the TX DMA channel */
+static txQueueEntry     sUartTxQueue[OT_PLAT_UART_TX_QUEUE_SIZE]; /* Buffers given to otPlatUartSend() */
+static uint8_t          sUartTxQueueHead;                        /* Oldest buffer not reported as sent */
+static volatile uint8_t sUartTxQueueCount;                       /* Buffers not reported as sent */
+static volatile uint8_t sUartTxQueueDone;                        /* Buffers sent, not reported yet */
+static uint16_t         sUartTxDmaOffset;                        /* Bytes of the current buffer already sent */
+static uint16_t         sUartTxDmaChunk;                         /* Bytes of the ongoing DMA transfer */
+static K32WUartTxStats  sUartTxStats;
+#endif
+#endif
+
+#if UART_USE_DRIVER_RX_DMA
+#if defined(__ICCARM__)
+#pragma data_alignment = 16
+static dma_descriptor_t sUartRxDmaDesc[UART_RX_DMA_NUM_OF_BLOCKS];
+#else
+__attribute__((aligned(16))) static dma_descriptor_t sUartRxDmaDesc[UART_RX_DMA_NUM_OF_BLOCKS];
+#endif
+#endif
 
 #if UART_USE_DRIVER_LOG
 static usart_handle_t sUartHandleLog; /* Handle to the UART module */
@@ -211,11 +364,26 @@ otError otPlatUartEnable(void)
         config.enableTx     = true;
         config.enableRx     = true;
         config.rxWatermark  = kUSART_RxFifo1;
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+        config.enableHardwareFlowControl = true;
+#endif
 
         uartStatus = USART_Init(USART0, &config, kPlatformClock);
         otEXPECT_ACTION(uartStatus == kStatus_Success, error = OT_ERROR_INVALID_ARGS);
 
+#if (UART_USE_DRIVER_RX_DMA || UART_USE_DRIVER_TX_DMA)
+        /* DMA0 is shared by the RX and TX channels, it is initialized once before both of them are set up */
+        DMA_Init(DMA0);
+#endif
+
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+        sIsRxFlowOff = false;
+#endif
+#if UART_USE_DRIVER_RX_DMA
+        K32WUartRxDmaInit();
+#else
         K32WResetRxRingBuffer(&sUartRxRing0);
+#endif
         FLEXCOMM_SetIRQHandler(USART0, (flexcomm_irq_handler_t)USART0_IRQHandler, &sUartHandleApp);
 
         /* Enable interrupt in NVIC. */
@@ -223,8 +391,18 @@ otError otPlatUartEnable(void)
         NVIC_ClearPendingIRQ(USART0_IRQn);
         EnableIRQ(USART0_IRQn);
 
+#if UART_USE_DRIVER_RX_DMA
+        /* Characters are moved by the DMA, only get an interrupt for the first start bit of a burst */
+        USART_EnableInterrupts(USART0, kUSART_RxErrorInterruptEnable);
+        USART0->INTENSET = USART_INTENSET_STARTEN_MASK;
+#else
         /* Enable RX interrupt for app */
         USART_EnableInterrupts(USART0, kUSART_RxLevelInterruptEnable | kUSART_RxErrorInterruptEnable);
+#endif
+
+#if UART_USE_DRIVER_TX_DMA
+        K32WUartTxDmaInit();
+#endif
 
 #endif
 
@@ -253,6 +431,17 @@ otError otPlatUartDisable(void)
     sIsUartInitialized = false;
 
 #if UART_USE_DRIVER
+#if UART_USE_DRIVER_RX_DMA
+    USART0->INTENCLR = USART_INTENCLR_STARTCLR_MASK;
+    USART_EnableRxDMA(USART0, false);
+    DMA_AbortTransfer(&sUartRxDmaHandle);
+#endif
+#if UART_USE_DRIVER_TX_DMA
+    USART_EnableTxDMA(USART0, false);
+    DMA_AbortTransfer(&sUartTxDmaHandle);
+    sUartTxQueueCount = 0;
+    sUartTxQueueDone  = 0;
+#endif
     USART_Deinit(USART0);
     USART_Deinit(USART1);
 #endif
@@ -264,7 +453,28 @@ otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
 {
     otError error = OT_ERROR_NONE;
 
-#if UART_USE_DRIVER
+#if UART_USE_DRIVER_TX_DMA
+
+    otEXPECT_ACTION(sUartTxQueueCount < OT_PLAT_UART_TX_QUEUE_SIZE, error = OT_ERROR_BUSY; sUartTxStats.stalls++);
+
+    DisableIRQ(DMA0_IRQn);
+    sUartTxQueue[(sUartTxQueueHead + sUartTxQueueCount) % OT_PLAT_UART_TX_QUEUE_SIZE].buffer = aBuf;
+    sUartTxQueue[(sUartTxQueueHead + sUartTxQueueCount) % OT_PLAT_UART_TX_QUEUE_SIZE].length = aBufLength;
+    sUartTxQueueCount++;
+
+    if (sUartTxQueueCount > sUartTxStats.maxQueueDepth)
+    {
+        sUartTxStats.maxQueueDepth = sUartTxQueueCount;
+    }
+
+    /* Start the DMA unless it is already busy with an earlier buffer */
+    if (sUartTxQueueCount - sUartTxQueueDone == 1)
+    {
+        K32WUartTxDmaStartNext();
+    }
+    EnableIRQ(DMA0_IRQn);
+
+#elif UART_USE_DRIVER
 
     otEXPECT_ACTION(!sUartHandleApp.txData, error = OT_ERROR_BUSY);
     sUartHandleApp.txData        = (uint8_t *)aBuf;
@@ -299,9 +509,13 @@ otError otPlatUartFlush(void)
 
     gTxFlush = TRUE;
 
-#if UART_USE_DRIVER
-    /* set to NULL in USART0_IRQHandler() */
-    while (sUartHandleApp.txData)
+#if UART_USE_DRIVER_TX_DMA
+    /* decremented in K32WProcessTransmit() once the characters have left the transmitter */
+    while (sUartTxQueueCount)
+
+#elif UART_USE_DRIVER
+    /* set to NULL in USART0_IRQHandler() when the last character is written to the TX FIFO */
+    while (sUartHandleApp.txData || K32WUartIsTransmitting())
 
 #elif UART_USE_SERIAL_MGR
     /* decremented in SerialMngr_TxCbApp() */
@@ -395,6 +609,145 @@ exit:
 }
 
 #if UART_USE_DRIVER
+/**
+ * Function used to check if characters are waiting in the TX FIFO or being shifted out.
+ *
+ * The USART has no TX idle interrupt enabled, so this is polled before a buffer is reported as sent.
+ *
+ * @return    TRUE              The transmitter is busy
+ * @return    FALSE             The transmitter is idle
+ */
+static bool K32WUartIsTransmitting(void)
+{
+    return (!(USART0->STAT & USART_STAT_TXIDLE_MASK) || !(USART0->FIFOSTAT & USART_FIFOSTAT_TXEMPTY_MASK));
+}
+
+#if UART_USE_DRIVER_TX_DMA
+/**
+ * Process TX characters in process context and call the upper layer call-backs.
+ *
+ * The upper layer is notified once per buffer sent by the DMA, in the order they were queued. The DMA is done with a
+ * buffer once its last character is in the TX FIFO, so the notification waits for the transmitter to be idle.
+ */
+static void K32WProcessTransmit(void)
+{
+    bool isDone;
+
+    do
+    {
+        DisableIRQ(DMA0_IRQn);
+        isDone = (sUartTxQueueDone != 0);
+
+        if (isDone && K32WUartIsTransmitting())
+        {
+            isDone = false;
+
+            /* Poll again unless the DMA callback signals the end of a later buffer */
+            if (sUartTxQueueCount == sUartTxQueueDone)
+            {
+                otSysEventSignalPending();
+            }
+        }
+
+        if (isDone)
+        {
+            sUartTxQueueHead = (sUartTxQueueHead + 1) % OT_PLAT_UART_TX_QUEUE_SIZE;
+            sUartTxQueueCount--;
+            sUartTxQueueDone--;
+        }
+        EnableIRQ(DMA0_IRQn);
+
+        /* txDone() may queue the next buffer, so it is called with the DMA interrupt enabled */
+        if (isDone)
+        {
+            txDone();
+        }
+    } while (isDone);
+}
+
+/**
+ * Function used to set up the DMA channel that fills the USART0 TX FIFO.
+ */
+static void K32WUartTxDmaInit(void)
+{
+    sUartTxQueueHead  = 0;
+    sUartTxQueueCount = 0;
+    sUartTxQueueDone  = 0;
+    sUartTxDmaOffset  = 0;
+
+    DMA_EnableChannel(DMA0, OT_PLAT_UART_TX_DMA_CHANNEL);
+    DMA_SetChannelPriority(DMA0, OT_PLAT_UART_TX_DMA_CHANNEL, kDMA_ChannelPriority2);
+    DMA_CreateHandle(&sUartTxDmaHandle, DMA0, OT_PLAT_UART_TX_DMA_CHANNEL);
+    DMA_SetCallback(&sUartTxDmaHandle, K32WUartTxDmaCallback, NULL);
+
+    USART_EnableTxDMA(USART0, true);
+}
+
+/**
+ * Function used to hand the next chunk of the oldest unsent buffer to the DMA.
+ * Buffers completely sent are accounted for in sUartTxQueueDone and reported by K32WProcessTransmit().
+ *
+ * Called from the DMA interrupt, or with it disabled.
+ */
+static void K32WUartTxDmaStartNext(void)
+{
+    dma_transfer_config_t transferConfig;
+    const txQueueEntry   *entry;
+
+    while (sUartTxQueueCount != sUartTxQueueDone)
+    {
+        entry = &sUartTxQueue[(sUartTxQueueHead + sUartTxQueueDone) % OT_PLAT_UART_TX_QUEUE_SIZE];
+
+        if (sUartTxDmaOffset < entry->length)
+        {
+            sUartTxDmaChunk = entry->length - sUartTxDmaOffset;
+
+            if (sUartTxDmaChunk > UART_TX_DMA_MAX_CHUNK)
+            {
+                sUartTxDmaChunk = UART_TX_DMA_MAX_CHUNK;
+            }
+
+            DMA_PrepareTransfer(&transferConfig, (void *)&entry->buffer[sUartTxDmaOffset], (void *)&USART0->FIFOWR,
+                                sizeof(uint8_t), sUartTxDmaChunk, kDMA_MemoryToPeripheral, NULL);
+            DMA_SubmitTransfer(&sUartTxDmaHandle, &transferConfig);
+            DMA_StartTransfer(&sUartTxDmaHandle);
+            break;
+        }
+
+        sUartTxDmaOffset = 0;
+        sUartTxQueueDone++;
+        sUartTxStats.buffersSent++;
+        otSysEventSignalPending();
+    }
+}
+
+static void K32WUartTxDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    OT_UNUSED_VARIABLE(handle);
+    OT_UNUSED_VARIABLE(userData);
+    OT_UNUSED_VARIABLE(transferDone);
+    OT_UNUSED_VARIABLE(intmode);
+
+    sUartTxDmaOffset += sUartTxDmaChunk;
+    sUartTxStats.bytesSent += sUartTxDmaChunk;
+    K32WUartTxDmaStartNext();
+}
+
+void K32WUartGetTxStats(K32WUartTxStats *aStats)
+{
+    DisableIRQ(DMA0_IRQn);
+    *aStats            = sUartTxStats;
+    aStats->queueDepth = sUartTxQueueCount;
+    EnableIRQ(DMA0_IRQn);
+}
+
+void K32WUartResetTxStats(void)
+{
+    DisableIRQ(DMA0_IRQn);
+    memset(&sUartTxStats, 0, sizeof(sUartTxStats));
+    EnableIRQ(DMA0_IRQn);
+}
+#else
 /**
  * Process TX characters in process context and call the upper layer call-backs.
  */
@@ -406,35 +759,251 @@ static void K32WProcessTransmit(void)
         txDone();
     }
 }
+#endif
 
+#if UART_USE_DRIVER_RX_DMA
 /**
  * Process RX characters in process context and call the upper layer call-backs.
+ *
+ * The characters written by the DMA since the last call are passed up straight from the circular buffer, as at most
+ * two contiguous spans. The start bit interrupt is re-armed once the receiver is idle, so the next burst wakes the
+ * system up again. The DMA requests stopped by K32WUartRxDmaCallback() are restarted once the buffer is drained.
  */
 static void K32WProcessReceive(void)
 {
-    uint8_t  rx[OT_PLAT_UART_RX_BUFFER_SIZE];
-    uint16_t rxIndex = 0;
-    uint8_t *pCharacter;
+    uint32_t writePos = K32WUartRxDmaGetWritePos();
+    uint32_t count    = writePos - sUartRxDmaReadPos;
+    uint32_t offset;
+    uint32_t span;
+    uint32_t lapped;
+
+    otEXPECT((int32_t)count > 0);
 
-    while ((pCharacter = K32WPopRxRingBuffer(&sUartRxRing0)) != NULL)
+    if (count > OT_PLAT_UART_RX_DMA_BUFFER_SIZE)
     {
-        rx[rxIndex] = *pCharacter;
-        rxIndex++;
+        /* The DMA lapped the reader, the oldest characters are lost */
+        sUartRxStats.droppedBytes += count - OT_PLAT_UART_RX_DMA_BUFFER_SIZE;
+        sUartRxDmaReadPos = writePos - OT_PLAT_UART_RX_DMA_BUFFER_SIZE;
+        count             = OT_PLAT_UART_RX_DMA_BUFFER_SIZE;
     }
-    otPlatUartReceived(rx, rxIndex);
+
+    offset = sUartRxDmaReadPos & (OT_PLAT_UART_RX_DMA_BUFFER_SIZE - 1);
+    span   = OT_PLAT_UART_RX_DMA_BUFFER_SIZE - offset;
+    span   = (count < span) ? count : span;
+
+    sUartRxDmaReadPos = writePos;
+
+    otPlatUartReceived(&sUartRxDmaBuffer[offset], span);
+
+    if (count > span)
+    {
+        otPlatUartReceived(&sUartRxDmaBuffer[0], count - span);
+    }
+
+    /* The DMA kept writing while the spans were parsed, check it didn't overwrite them */
+    lapped = K32WUartRxDmaGetWritePos() - (writePos - count);
+
+    if (lapped > OT_PLAT_UART_RX_DMA_BUFFER_SIZE)
+    {
+        lapped -= OT_PLAT_UART_RX_DMA_BUFFER_SIZE;
+        sUartRxStats.overwrittenBytes += (lapped < count) ? lapped : count;
+    }
+
+exit:
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+    DisableIRQ(DMA0_IRQn);
+    if (sIsRxFlowOff && (K32WUartRxDmaGetWritePos() - sUartRxDmaReadPos <= OT_PLAT_UART_RX_FLOW_ON_LEVEL))
+    {
+        /* Let the DMA empty the RX FIFO again, RTS is asserted as soon as it has room */
+        sIsRxFlowOff = false;
+        USART_EnableRxDMA(USART0, true);
+    }
+    EnableIRQ(DMA0_IRQn);
+#endif
+
+    if (!(USART0->INTENSET & USART_INTENSET_STARTEN_MASK))
+    {
+        if (K32WUartIsReceiving())
+        {
+            /* A character is still on the line, poll until it lands in the buffer */
+            otSysEventSignalPending();
+        }
+        else
+        {
+            USART0->STAT     = USART_STAT_START_MASK;
+            USART0->INTENSET = USART_INTENSET_STARTEN_MASK;
+
+            /* Catch characters completed between the drain and the re-arm */
+            if (K32WUartRxDmaGetWritePos() != sUartRxDmaReadPos)
+            {
+                otSysEventSignalPending();
+            }
+        }
+    }
+}
+
+/**
+ * Function used to set up the DMA channel that empties the USART0 RX FIFO into sUartRxDmaBuffer.
+ *
+ * A chain of descriptors, one per block, with the last one reloading the first makes the transfer circular, so the DMA
+ * never has to be restarted by software. The end of each block raises an interrupt which counts the blocks and checks
+ * the flow control level.
+ */
+static void K32WUartRxDmaInit(void)
+{
+    dma_transfer_config_t transferConfig;
+
+    sUartRxDmaBlocks  = 0;
+    sUartRxDmaReadPos = 0;
+
+    DMA_EnableChannel(DMA0, OT_PLAT_UART_RX_DMA_CHANNEL);
+    DMA_SetChannelPriority(DMA0, OT_PLAT_UART_RX_DMA_CHANNEL, kDMA_ChannelPriority1);
+    DMA_CreateHandle(&sUartRxDmaHandle, DMA0, OT_PLAT_UART_RX_DMA_CHANNEL);
+    DMA_SetCallback(&sUartRxDmaHandle, K32WUartRxDmaCallback, NULL);
+
+    USART_EnableRxDMA(USART0, true);
+
+    DMA_PrepareTransfer(&transferConfig, (void *)&USART0->FIFORD, sUartRxDmaBuffer, sizeof(uint8_t),
+                        UART_RX_DMA_BLOCK_SIZE, kDMA_PeripheralToMemory,
+                        &sUartRxDmaDesc[1 % UART_RX_DMA_NUM_OF_BLOCKS]);
+    DMA_SubmitTransfer(&sUartRxDmaHandle, &transferConfig);
+    transferConfig.xfercfg.intA = true;
+    transferConfig.xfercfg.intB = false;
+
+    for (uint8_t i = 0; i < UART_RX_DMA_NUM_OF_BLOCKS; i++)
+    {
+        DMA_CreateDescriptor(&sUartRxDmaDesc[i], &transferConfig.xfercfg, (void *)&USART0->FIFORD,
+                             &sUartRxDmaBuffer[i * UART_RX_DMA_BLOCK_SIZE],
+                             &sUartRxDmaDesc[(i + 1) % UART_RX_DMA_NUM_OF_BLOCKS]);
+    }
+
+    DMA_StartTransfer(&sUartRxDmaHandle);
+}
+
+/**
+ * Function used to get the number of characters written by the DMA since the UART was enabled.
+ *
+ * A block that ended while the interrupts are masked is still pending in INTA and is accounted for here, so the
+ * returned position never goes backwards.
+ *
+ * @return    The DMA write position, modulo 2^32
+ */
+static uint32_t K32WUartRxDmaGetWritePos(void)
+{
+    uint32_t regPrimask;
+    uint32_t remaining;
+    uint32_t blocks;
+    bool     isBlockPending;
+
+    regPrimask = DisableGlobalIRQ();
+    do
+    {
+        isBlockPending = ((DMA0->COMMON[0].INTA & (1U << OT_PLAT_UART_RX_DMA_CHANNEL)) != 0);
+        remaining      = DMA_GetRemainingBytes(DMA0, OT_PLAT_UART_RX_DMA_CHANNEL);
+    } while (isBlockPending != ((DMA0->COMMON[0].INTA & (1U << OT_PLAT_UART_RX_DMA_CHANNEL)) != 0));
+    blocks = sUartRxDmaBlocks + (isBlockPending ? 1 : 0);
+    EnableGlobalIRQ(regPrimask);
+
+    return (blocks + 1) * UART_RX_DMA_BLOCK_SIZE - remaining;
+}
+
+/**
+ * Function used to check if a character is being received or waits in the RX FIFO for the DMA.
+ *
+ * The USART has no idle line interrupt, this is used instead to decide when the start bit interrupt can be re-armed.
+ *
+ * @return    TRUE              The receiver is busy
+ * @return    FALSE             The receiver is idle
+ */
+static bool K32WUartIsReceiving(void)
+{
+    return (!(USART0->STAT & USART_STAT_RXIDLE_MASK) || (USART0->FIFOSTAT & USART_FIFOSTAT_RXNOTEMPTY_MASK));
 }
 
+static void K32WUartRxDmaCallback(dma_handle_t *handle, void *userData, bool transferDone, uint32_t intmode)
+{
+    OT_UNUSED_VARIABLE(handle);
+    OT_UNUSED_VARIABLE(userData);
+    OT_UNUSED_VARIABLE(transferDone);
+    OT_UNUSED_VARIABLE(intmode);
+
+    sUartRxDmaBlocks++;
+
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+    if (!sIsRxFlowOff && (K32WUartRxDmaGetWritePos() - sUartRxDmaReadPos >= OT_PLAT_UART_RX_FLOW_OFF_LEVEL))
+    {
+        /* Leave the next characters in the RX FIFO, RTS is deasserted when it fills up */
+        USART_EnableRxDMA(USART0, false);
+        sIsRxFlowOff = true;
+        sUartRxStats.flowOffs++;
+    }
+#endif
+
+    otSysEventSignalPending();
+}
+#else
+/**
+ * Process RX characters in process context and call the upper layer call-backs.
+ *
+ * The characters are passed up straight from the RX Ring buffer, as at most two contiguous spans.
+ */
+static void K32WProcessReceive(void)
+{
+    rxRingSpan spans[2];
+    uint16_t   count = K32WPeekRxRingBuffer(&sUartRxRing0, spans);
+
+    if (count != 0)
+    {
+        otPlatUartReceived(spans[0].buffer, spans[0].length);
+
+        if (spans[1].length != 0)
+        {
+            otPlatUartReceived(spans[1].buffer, spans[1].length);
+        }
+    }
+
+    K32WReleaseRxRingBuffer(&sUartRxRing0, count);
+
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+    DisableIRQ(USART0_IRQn);
+    if (sIsRxFlowOff && (K32WGetRxRingBufferLevel(&sUartRxRing0) <= OT_PLAT_UART_RX_FLOW_ON_LEVEL))
+    {
+        /* Drain the RX FIFO again, RTS is asserted as soon as it has room */
+        sIsRxFlowOff         = false;
+        USART0->FIFOINTENSET = USART_FIFOINTENSET_RXLVL_MASK;
+    }
+    EnableIRQ(USART0_IRQn);
+#endif
+}
+#endif
+
 static void USART0_IRQHandler(USART_Type *base, usart_handle_t *handle)
 {
     (void)base;
     (void)handle;
 
+#if UART_USE_DRIVER_RX_DMA
+    bool isReceiveEnabled = false;
+#elif OT_PLAT_UART_HW_FLOW_CONTROL
+    bool isReceiveEnabled = !sIsRxFlowOff;
+#else
     bool isReceiveEnabled = true;
-    bool isSendEnabled    = (sUartHandleApp.txDataSize != 0);
+#endif
+    bool isSendEnabled = (sUartHandleApp.txDataSize != 0);
+
+#if UART_USE_DRIVER_RX_DMA
+    /* First character of a burst, the rest is collected by the DMA */
+    if ((USART0->INTENSET & USART_INTENSET_STARTEN_MASK) && (USART0->STAT & USART_STAT_START_MASK))
+    {
+        USART0->INTENCLR = USART_INTENCLR_STARTCLR_MASK;
+        USART0->STAT     = USART_STAT_START_MASK;
+    }
+#endif
 
     /* If RX overrun. */
     if (USART0->FIFOSTAT & USART_FIFOSTAT_RXERR_MASK)
     {
+        sUartRxStats.overruns++;
         /* Clear RX error state. */
         USART0->FIFOSTAT |= USART_FIFOSTAT_RXERR_MASK;
         /* clear RX FIFO */
@@ -446,11 +1015,24 @@ static void USART0_IRQHandler(USART_Type *base, usart_handle_t *handle)
         /* RX: an interrupt is fired for each received character */
         if (isReceiveEnabled && (USART0->FIFOSTAT & USART_FIFOSTAT_RXNOTEMPTY_MASK))
         {
+#if !UART_USE_DRIVER_RX_DMA
             volatile uint8_t rx_data = USART_ReadByte(USART0);
 
             {
                 K32WPushRxRingBuffer(&sUartRxRing0, rx_data);
             }
+
+#if OT_PLAT_UART_HW_FLOW_CONTROL
+            if (K32WGetRxRingBufferLevel(&sUartRxRing0) >= OT_PLAT_UART_RX_FLOW_OFF_LEVEL)
+            {
+                /* Leave the next characters in the RX FIFO, RTS is deasserted when it fills up */
+                USART0->FIFOINTENCLR = USART_FIFOINTENCLR_RXLVL_MASK;
+                sIsRxFlowOff         = true;
+                isReceiveEnabled     = false;
+                sUartRxStats.flowOffs++;
+            }
+#endif
+#endif
         }
 
         /* There are times when the UART interrupt fires unnecessarily
@@ -481,64 +1063,120 @@ static void USART0_IRQHandler(USART_Type *base, usart_handle_t *handle)
     otSysEventSignalPending();
 }
 
+void K32WUartGetRxStats(K32WUartRxStats *aStats)
+{
+    uint32_t regPrimask;
+
+    /* updated from both the USART0 and the DMA interrupts */
+    regPrimask = DisableGlobalIRQ();
+    *aStats    = sUartRxStats;
+    EnableGlobalIRQ(regPrimask);
+}
+
+void K32WUartResetRxStats(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    memset(&sUartRxStats, 0, sizeof(sUartRxStats));
+    EnableGlobalIRQ(regPrimask);
+}
+
+#if !UART_USE_DRIVER_RX_DMA
 /**
  * Function used to push a received character to the RX Ring buffer.
- * In case the ring buffer is full, the oldest address is overwritten.
+ * In case the ring buffer is full, the received character is dropped: overwriting the oldest
+ * ones would corrupt a frame the upper layer already started to parse.
  *
  * @param[in] aRxRing             Pointer to the RX Ring Buffer
  * @param[in] aCharacter          The received character
  */
 static void K32WPushRxRingBuffer(rxRingBuffer *aRxRing, uint8_t aCharacter)
 {
+    uint16_t level;
+
+    otEXPECT_ACTION(!aRxRing->isFull, sUartRxStats.droppedBytes++);
+
     aRxRing->buffer[aRxRing->head] = aCharacter;
+    aRxRing->head                  = (aRxRing->head + 1) % OT_PLAT_UART_RX_BUFFER_SIZE;
+    aRxRing->isFull                = (aRxRing->head == aRxRing->tail);
+
+    level = K32WGetRxRingBufferLevel(aRxRing);
 
-    if (aRxRing->isFull)
+    if (level > sUartRxStats.maxLevel)
     {
-        aRxRing->tail = (aRxRing->tail + 1) % OT_PLAT_UART_RX_BUFFER_SIZE;
+        sUartRxStats.maxLevel = level;
     }
 
-    aRxRing->head   = (aRxRing->head + 1) % OT_PLAT_UART_RX_BUFFER_SIZE;
-    aRxRing->isFull = (aRxRing->head == aRxRing->tail);
+exit:
+    return;
 }
 
 /**
- * Function used to pop the address of a received character from the RX Ring buffer
- * Process Context: the consumer will pop frames with the interrupts disabled
- *                  to make sure the interrupt context(ISR) doesn't push in
- *                  the middle of a pop.
+ * Function used to get the number of characters in an RX Ring buffer.
  *
  * @param[in] aRxRing           Pointer to the RX Ring Buffer
  *
- * @return    tsRxFrameFormat   Pointer to a received character
- * @return    NULL              In case the RX Ring buffer is empty
+ * @return    The number of received characters not consumed yet
  */
-static uint8_t *K32WPopRxRingBuffer(rxRingBuffer *aRxRing)
+static uint16_t K32WGetRxRingBufferLevel(const rxRingBuffer *aRxRing)
 {
-    uint8_t *pCharacter = NULL;
+    uint16_t level = (aRxRing->head + OT_PLAT_UART_RX_BUFFER_SIZE - aRxRing->tail) % OT_PLAT_UART_RX_BUFFER_SIZE;
+
+    return aRxRing->isFull ? OT_PLAT_UART_RX_BUFFER_SIZE : level;
+}
+
+/**
+ * Function used to get all the received characters from the RX Ring buffer, without copying them.
+ * The head is sampled once with the interrupts disabled and the characters up to it are returned
+ * as at most two contiguous spans, the second one being empty if the data does not wrap.
+ *
+ * The ISR only writes past the head, so the spans stay valid until K32WReleaseRxRingBuffer() is called.
+ *
+ * @param[in]  aRxRing          Pointer to the RX Ring Buffer
+ * @param[out] aSpans           The contiguous spans of received characters
+ *
+ * @return    The total number of received characters
+ */
+static uint16_t K32WPeekRxRingBuffer(rxRingBuffer *aRxRing, rxRingSpan aSpans[2])
+{
+    uint16_t count;
+    uint8_t  tail;
 
     DisableIRQ(USART0_IRQn);
-    if (!K32WIsEmptyRxRingBuffer(aRxRing))
+    tail  = aRxRing->tail;
+    count = K32WGetRxRingBufferLevel(aRxRing);
+    EnableIRQ(USART0_IRQn);
+
+    aSpans[0].buffer = &aRxRing->buffer[tail];
+    aSpans[0].length = OT_PLAT_UART_RX_BUFFER_SIZE - tail;
+
+    if (aSpans[0].length > count)
     {
-        pCharacter      = &(aRxRing->buffer[aRxRing->tail]);
-        aRxRing->isFull = false;
-        aRxRing->tail   = (aRxRing->tail + 1) % OT_PLAT_UART_RX_BUFFER_SIZE;
+        aSpans[0].length = count;
     }
-    EnableIRQ(USART0_IRQn);
 
-    return pCharacter;
+    aSpans[1].buffer = &aRxRing->buffer[0];
+    aSpans[1].length = count - aSpans[0].length;
+
+    return count;
 }
 
 /**
- * Function used to check if an RX Ring buffer is empty
+ * Function used to consume the characters returned by K32WPeekRxRingBuffer().
  *
  * @param[in] aRxRing           Pointer to the RX Ring Buffer
- *
- * @return    TRUE              RX Ring Buffer is not empty
- * @return    FALSE             RX Ring Buffer is empty
+ * @param[in] aCount            Number of characters consumed
  */
-static bool K32WIsEmptyRxRingBuffer(rxRingBuffer *aRxRing)
+static void K32WReleaseRxRingBuffer(rxRingBuffer *aRxRing, uint16_t aCount)
 {
-    return (!aRxRing->isFull && (aRxRing->head == aRxRing->tail));
+    DisableIRQ(USART0_IRQn);
+    if (aCount != 0)
+    {
+        aRxRing->tail   = (aRxRing->tail + aCount) % OT_PLAT_UART_RX_BUFFER_SIZE;
+        aRxRing->isFull = false;
+    }
+    EnableIRQ(USART0_IRQn);
 }
 
 /**
@@ -552,8 +1190,33 @@ static void K32WResetRxRingBuffer(rxRingBuffer *aRxRing)
     aRxRing->tail   = 0;
     aRxRing->isFull = false;
 }
+#endif /* !UART_USE_DRIVER_RX_DMA */
 #endif /* UART_USE_DRIVER */
 
+#if !UART_USE_DRIVER
+/* The statistics are only kept by the Uart driver */
+void K32WUartGetRxStats(K32WUartRxStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+}
+
+void K32WUartResetRxStats(void)
+{
+}
+#endif
+
+#if !UART_USE_DRIVER_TX_DMA
+/* The statistics are only kept by the DMA transmit queue */
+void K32WUartGetTxStats(K32WUartTxStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+}
+
+void K32WUartResetTxStats(void)
+{
+}
+#endif
+
 #if UART_USE_SERIAL_MGR
 static void SerialMngr_TxCbApp(void *param)
 {